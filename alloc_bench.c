@@ -0,0 +1,294 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "alloc_track.h"
+#include "int_fixture.h"
+#include "table_backend.h"
+#include "stack.h"
+
+/**
+ * alloc_bench.c - Count the heap allocations of the table and stack operations.
+ *
+ * The program is linked with alloc_track.c, which replaces malloc,
+ * calloc, realloc and free, with the table loader and with one
+ * implementation of stack.h. The tables are built as shared objects
+ * as described in table_backend.h:
+ *
+ *   gcc -O2 -I<include> -DSTACK_BACKEND='"chunkstack"' alloc_bench.c \
+ *       alloc_track.c table_backend.c table_ext.c int_fixture.c chunkstack.c \
+ *       arena.c -ldl
+ *
+ * Usage: alloc_bench [-n n] [backend.so...]
+ *
+ * For each table backend, creates a table and runs n (default 10000)
+ * operations of each kind:
+ *  - insert:      insert n distinct keys,
+ *  - reinsert:    insert each key again with a new value,
+ *  - lookup_hit:  look up each key,
+ *  - lookup_miss: look up n keys that are not in the table,
+ *  - choose_key:  ask for a key before each remove,
+ *  - remove:      remove that key, until the table is empty,
+ * and counts the allocations made by each operation. table_empty and
+ * table_kill are counted as well. The stack pushes n elements,
+ * inspects the top n times and pops them all. The keys and values are
+ * allocated before the counting starts and are not killed by the
+ * tables, so only the memory of the data structures is counted.
+ *
+ * For each operation, the program prints the number of calls and the
+ * allocations, frees and bytes allocated per call. For each backend
+ * it prints the peak of live bytes during the run, not counting the
+ * memory that was live before it started, and the bytes still live
+ * after the kill, which are leaked.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Use compare_int from int_fixture.c.
+ */
+
+#ifndef STACK_BACKEND
+#define STACK_BACKEND "stack"
+#endif
+
+#define DEFAULT_N 10000
+
+// The operations counted, in the order they are printed. The tables
+// and the stack share empty and kill.
+typedef enum op_kind {
+    OP_EMPTY,
+    OP_INSERT,
+    OP_REINSERT,
+    OP_LOOKUP_HIT,
+    OP_LOOKUP_MISS,
+    OP_CHOOSE_KEY,
+    OP_REMOVE,
+    OP_PUSH,
+    OP_TOP,
+    OP_POP,
+    OP_KILL,
+    NUM_OPS
+} op_kind;
+
+static const char *op_names[NUM_OPS] = {
+    "empty", "insert", "reinsert", "lookup_hit", "lookup_miss", "choose_key", "remove",
+    "push", "top", "pop", "kill"
+};
+
+// Allocation counts of one operation kind.
+typedef struct op_count {
+    long calls;
+    long allocs;
+    long frees;
+    long long bytes;
+} op_count;
+
+// Receives the results of stack_top() so that they are used.
+static volatile long sink;
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * account() - Add the allocations since a snapshot to an operation.
+ * @c: Counts of the operation.
+ * @before: Snapshot taken before the call.
+ *
+ * Returns: Nothing.
+ */
+static void account(op_count *c, const alloc_stats *before)
+{
+    alloc_stats after = alloc_track_get();
+
+    c->calls++;
+    c->allocs += after.allocs - before->allocs;
+    c->frees += after.frees - before->frees;
+    c->bytes += after.bytes - before->bytes;
+}
+
+/**
+ * print_counts() - Print the counts of a backend.
+ * @backend: Name of the backend.
+ * @counts: Counts of all operations.
+ * @start: Snapshot taken before the first operation.
+ *
+ * Operations that were not called are skipped.
+ *
+ * Returns: Nothing.
+ */
+static void print_counts(const char *backend, const op_count counts[NUM_OPS],
+                         const alloc_stats *start)
+{
+    alloc_stats end = alloc_track_get();
+
+    for (int op = 0; op < NUM_OPS; op++) {
+        const op_count *c = &counts[op];
+        if (c->calls == 0) {
+            continue;
+        }
+        printf("%-12s %-12s %9ld %10.3f %10.3f %10.1f\n", backend, op_names[op], c->calls,
+               (double)c->allocs / c->calls, (double)c->frees / c->calls,
+               (double)c->bytes / c->calls);
+    }
+    printf("%-12s peak live bytes %lld, leaked bytes %lld\n", backend, end.peak - start->live,
+           end.live - start->live);
+}
+
+/**
+ * table_run() - Count the allocations of one table backend.
+ * @b: Backend to run.
+ * @keys: 2n distinct keys. The first n are inserted, the rest are missing.
+ * @values: 2n values.
+ * @n: Number of operations of each kind.
+ *
+ * Returns: Nothing.
+ */
+static void table_run(const table_backend *b, int *keys, int *values, int n)
+{
+    op_count counts[NUM_OPS] = { { 0 } };
+    alloc_stats start = alloc_track_get();
+    alloc_stats a;
+    long found = 0;
+    table *t;
+
+    alloc_track_reset_peak();
+
+    a = alloc_track_get();
+    if (b->empty_hashed != NULL) {
+        t = b->empty_hashed(compare_int, hash_int, NULL, NULL);
+    } else {
+        t = b->empty(compare_int, NULL, NULL);
+    }
+    account(&counts[OP_EMPTY], &a);
+
+    for (int i = 0; i < n; i++) {
+        a = alloc_track_get();
+        b->insert(t, &keys[i], &values[i]);
+        account(&counts[OP_INSERT], &a);
+    }
+    for (int i = 0; i < n; i++) {
+        a = alloc_track_get();
+        b->insert(t, &keys[i], &values[n + i]);
+        account(&counts[OP_REINSERT], &a);
+    }
+    for (int i = 0; i < n; i++) {
+        a = alloc_track_get();
+        void *v = b->lookup(t, &keys[i]);
+        account(&counts[OP_LOOKUP_HIT], &a);
+        found += v != NULL;
+    }
+    for (int i = n; i < 2 * n; i++) {
+        a = alloc_track_get();
+        void *v = b->lookup(t, &keys[i]);
+        account(&counts[OP_LOOKUP_MISS], &a);
+        found += v != NULL;
+    }
+    while (!b->is_empty(t)) {
+        a = alloc_track_get();
+        void *k = b->choose_key(t);
+        account(&counts[OP_CHOOSE_KEY], &a);
+        a = alloc_track_get();
+        b->remove(t, k);
+        account(&counts[OP_REMOVE], &a);
+    }
+
+    a = alloc_track_get();
+    b->kill(t);
+    account(&counts[OP_KILL], &a);
+
+    if (found != n) {
+        fprintf(stderr, "%s: %ld of %d lookups found a value, expected %d\n", b->name, found,
+                2 * n, n);
+    }
+    print_counts(b->name, counts, &start);
+}
+
+/**
+ * stack_run() - Count the allocations of the stack.
+ * @values: n values.
+ * @n: Number of operations of each kind.
+ *
+ * Returns: Nothing.
+ */
+static void stack_run(int *values, int n)
+{
+    op_count counts[NUM_OPS] = { { 0 } };
+    alloc_stats start = alloc_track_get();
+    alloc_stats a;
+
+    alloc_track_reset_peak();
+
+    a = alloc_track_get();
+    stack *s = stack_empty(NULL);
+    account(&counts[OP_EMPTY], &a);
+
+    for (int i = 0; i < n; i++) {
+        a = alloc_track_get();
+        s = stack_push(s, &values[i]);
+        account(&counts[OP_PUSH], &a);
+    }
+    for (int i = 0; i < n; i++) {
+        a = alloc_track_get();
+        sink += *(int *)stack_top(s);
+        account(&counts[OP_TOP], &a);
+    }
+    for (int i = 0; i < n; i++) {
+        a = alloc_track_get();
+        s = stack_pop(s);
+        account(&counts[OP_POP], &a);
+    }
+
+    a = alloc_track_get();
+    stack_kill(s);
+    account(&counts[OP_KILL], &a);
+
+    print_counts(STACK_BACKEND, counts, &start);
+}
+
+int main(int argc, char *argv[])
+{
+    int n = DEFAULT_N;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        switch (opt) {
+        case 'n': n = atoi(optarg); break;
+        default:  n = 0;            break;
+        }
+    }
+    if (n <= 0) {
+        fprintf(stderr, "Usage: %s [-n n] [backend.so...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Keys in a scrambled order, so that sorted and hashed backends
+    // see a realistic insertion order.
+    int *keys = malloc(2 * n * sizeof(int));
+    int *values = malloc(2 * n * sizeof(int));
+    for (int i = 0; i < 2 * n; i++) {
+        keys[i] = i;
+        values[i] = i;
+    }
+    for (int i = 2 * n - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+
+    printf("%-12s %-12s %9s %10s %10s %10s\n", "backend", "op", "calls", "allocs/op",
+           "frees/op", "bytes/op");
+    for (int i = optind; i < argc; i++) {
+        table_backend *b = table_backend_load(argv[i]);
+        if (b == NULL) {
+            return EXIT_FAILURE;
+        }
+        table_run(b, keys, values, n);
+        table_backend_unload(b);
+    }
+    stack_run(values, n);
+
+    free(keys);
+    free(values);
+    return 0;
+}
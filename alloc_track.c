@@ -0,0 +1,194 @@
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <malloc.h>
+#include <dlfcn.h>
+
+#include "alloc_track.h"
+
+/*
+ * Tracking of heap allocations, see alloc_track.h.
+ *
+ * The functions defined here take precedence over the C library's
+ * because the program is searched first when symbols are resolved.
+ * The C library functions are found with dlsym(RTLD_NEXT). dlsym
+ * itself may call calloc before the lookup is done; those early
+ * requests are served from a small static buffer that is never freed.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// Size of the buffer for allocations made while looking up the C
+// library functions.
+#define BOOTSTRAP_SIZE 4096
+
+// ===========INTERNAL DATA ============
+
+static void *(*real_malloc)(size_t);
+static void *(*real_calloc)(size_t, size_t);
+static void *(*real_realloc)(void *, size_t);
+static void (*real_free)(void *);
+
+static _Alignas(max_align_t) char bootstrap[BOOTSTRAP_SIZE];
+static size_t bootstrap_used = 0;
+static int initializing = 0;
+
+static alloc_stats stats;
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * init() - Look up the C library allocation functions.
+ *
+ * Returns: Nothing.
+ */
+static void init(void)
+{
+    initializing = 1;
+    *(void **)&real_malloc = dlsym(RTLD_NEXT, "malloc");
+    *(void **)&real_calloc = dlsym(RTLD_NEXT, "calloc");
+    *(void **)&real_realloc = dlsym(RTLD_NEXT, "realloc");
+    *(void **)&real_free = dlsym(RTLD_NEXT, "free");
+    initializing = 0;
+}
+
+// Internal function to check if a pointer is in the bootstrap buffer.
+static int is_bootstrap(const void *p)
+{
+    return (const char *)p >= bootstrap && (const char *)p < bootstrap + BOOTSTRAP_SIZE;
+}
+
+/**
+ * bootstrap_alloc() - Allocate zeroed memory from the bootstrap buffer.
+ * @size: Number of bytes.
+ *
+ * Returns: A pointer to the memory, or NULL if the buffer is full.
+ */
+static void *bootstrap_alloc(size_t size)
+{
+    size = (size + sizeof(max_align_t) - 1) / sizeof(max_align_t) * sizeof(max_align_t);
+    if (bootstrap_used + size > BOOTSTRAP_SIZE) {
+        return NULL;
+    }
+    void *p = bootstrap + bootstrap_used;
+    bootstrap_used += size;
+
+    return p;
+}
+
+// Internal functions to update the counters.
+static void record_alloc(void *p)
+{
+    stats.allocs++;
+    size_t size = malloc_usable_size(p);
+    stats.bytes += size;
+    stats.live += size;
+    if (stats.live > stats.peak) {
+        stats.peak = stats.live;
+    }
+}
+
+static void record_free(void *p)
+{
+    stats.frees++;
+    stats.live -= malloc_usable_size(p);
+}
+
+// ===========REPLACEMENTS OF THE C LIBRARY FUNCTIONS ============
+
+void *malloc(size_t size)
+{
+    if (real_malloc == NULL) {
+        if (initializing) {
+            return bootstrap_alloc(size);
+        }
+        init();
+    }
+    void *p = real_malloc(size);
+    if (p != NULL) {
+        record_alloc(p);
+    }
+    return p;
+}
+
+void *calloc(size_t n, size_t size)
+{
+    if (real_calloc == NULL) {
+        if (initializing) {
+            // The buffer is static and thus already zeroed.
+            return size == 0 || n <= SIZE_MAX / size ? bootstrap_alloc(n * size) : NULL;
+        }
+        init();
+    }
+    void *p = real_calloc(n, size);
+    if (p != NULL) {
+        record_alloc(p);
+    }
+    return p;
+}
+
+void *realloc(void *old, size_t size)
+{
+    if (real_realloc == NULL) {
+        init();
+    }
+    if (is_bootstrap(old)) {
+        // Move the block to the heap. Its old size is unknown, but at
+        // most the rest of the buffer.
+        void *p = malloc(size);
+        size_t avail = bootstrap + BOOTSTRAP_SIZE - (char *)old;
+        if (p != NULL) {
+            memcpy(p, old, size < avail ? size : avail);
+        }
+        return p;
+    }
+    if (old != NULL) {
+        record_free(old);
+    }
+    void *p = real_realloc(old, size);
+    if (p != NULL) {
+        record_alloc(p);
+    } else if (old != NULL && size > 0) {
+        // The old block is still allocated.
+        stats.frees--;
+        stats.live += malloc_usable_size(old);
+    }
+    return p;
+}
+
+void free(void *p)
+{
+    if (p == NULL || is_bootstrap(p)) {
+        return;
+    }
+    if (real_free == NULL) {
+        init();
+    }
+    record_free(p);
+    real_free(p);
+}
+
+// ===========INTERFACE ============
+
+/**
+ * alloc_track_get() - Take a snapshot of the allocation counters.
+ *
+ * Returns: The current counters.
+ */
+alloc_stats alloc_track_get(void)
+{
+    return stats;
+}
+
+/**
+ * alloc_track_reset_peak() - Set the peak of live bytes to the current value.
+ *
+ * Returns: Nothing.
+ */
+void alloc_track_reset_peak(void)
+{
+    stats.peak = stats.live;
+}
@@ -0,0 +1,52 @@
+#ifndef ALLOC_TRACK_H
+#define ALLOC_TRACK_H
+
+/*
+ * Tracking of heap allocations for tests and benchmarks.
+ *
+ * Linking alloc_track.c into a program replaces malloc, calloc,
+ * realloc and free for the whole process, including shared objects
+ * loaded with dlopen(). The replacements call the C library functions
+ * and count the calls and the bytes. A harness attributes allocations
+ * to an operation by taking a snapshot before and after it.
+ *
+ * Sizes are the usable sizes reported by malloc_usable_size(), so a
+ * freed block subtracts exactly what its allocation added. The
+ * counters are not atomic; allocations in several threads at the same
+ * time give approximate numbers. aligned_alloc and posix_memalign are
+ * not tracked.
+ *
+ * Requires glibc or another C library with malloc_usable_size().
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// Allocation counters since the start of the program.
+typedef struct alloc_stats {
+    long allocs; // Calls to malloc, calloc and realloc that returned memory
+    long frees; // Calls to free and realloc that released memory
+    long long bytes; // Total bytes allocated
+    long long live; // Bytes allocated and not yet freed
+    long long peak; // Largest value of live since the last reset
+} alloc_stats;
+
+// ==========INTERFACE==========
+
+/**
+ * alloc_track_get() - Take a snapshot of the allocation counters.
+ *
+ * Returns: The current counters.
+ */
+alloc_stats alloc_track_get(void);
+
+/**
+ * alloc_track_reset_peak() - Set the peak of live bytes to the current value.
+ *
+ * Returns: Nothing.
+ */
+void alloc_track_reset_peak(void);
+
+#endif
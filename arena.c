@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdalign.h>
+
+#include "arena.h"
+
+// Default size in bytes of a block.
+#define DEFAULT_BLOCK_SIZE 65536
+
+/*
+ * Implementation of a memory arena for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The arena is a linked list of blocks. Allocations are carved from
+ * the current block by bumping its used count. When the current block
+ * is full, the arena moves on to the next block in the list, which
+ * exists after a reset, or appends a new one. arena_reset() rewinds
+ * to the first block so the blocks are reused.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct block {
+    struct block *next;
+    size_t size; // Number of usable bytes in data
+    size_t used; // Number of allocated bytes in data
+    max_align_t data[];
+} block;
+
+struct arena {
+    block *first; // First block, or NULL
+    block *current; // Block that allocations are taken from, or NULL
+    size_t block_size;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * block_new() - Allocate a new empty block.
+ * @size: Number of usable bytes.
+ *
+ * Returns: A pointer to the new block.
+ */
+static block *block_new(size_t size)
+{
+    block *b = malloc(sizeof(*b) + size);
+    b->next = NULL;
+    b->size = size;
+    b->used = 0;
+
+    return b;
+}
+
+/**
+ * arena_empty() - Create an empty arena.
+ * @block_size: Size in bytes of each block, or 0 for a default size.
+ *
+ * Returns: A pointer to the new arena.
+ */
+arena *arena_empty(size_t block_size)
+{
+    arena *a = calloc(1, sizeof(*a));
+    a->block_size = block_size > 0 ? block_size : DEFAULT_BLOCK_SIZE;
+
+    return a;
+}
+
+/**
+ * arena_alloc() - Allocate memory from an arena.
+ * @a: Arena to allocate from.
+ * @size: Number of bytes to allocate.
+ *
+ * Returns: A pointer to the allocated memory.
+ */
+void *arena_alloc(arena *a, size_t size)
+{
+    // Round up so that the next allocation is also aligned.
+    size = (size + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+
+    block *b = a->current;
+    while (b != NULL && b->used + size > b->size) {
+        if (b->next == NULL) {
+            break;
+        }
+        // Unused block left by a reset. Blocks too small for the
+        // request are skipped until the next reset.
+        b = b->next;
+    }
+
+    if (b == NULL || b->used + size > b->size) {
+        block *fresh = block_new(size > a->block_size ? size : a->block_size);
+        if (b == NULL) {
+            a->first = fresh;
+        } else {
+            b->next = fresh;
+        }
+        b = fresh;
+    }
+    a->current = b;
+
+    void *p = (char *)b->data + b->used;
+    b->used += size;
+
+    return p;
+}
+
+/**
+ * arena_reset() - Release all allocations in an arena.
+ * @a: Arena to reset.
+ *
+ * Returns: Nothing.
+ */
+void arena_reset(arena *a)
+{
+    for (block *b = a->first; b != NULL; b = b->next) {
+        b->used = 0;
+    }
+    a->current = a->first;
+}
+
+/**
+ * arena_kill() - Destroy an arena.
+ * @a: Arena to destroy.
+ *
+ * Returns: Nothing.
+ */
+void arena_kill(arena *a)
+{
+    block *b = a->first;
+
+    while (b != NULL) {
+        block *next = b->next;
+        free(b);
+        b = next;
+    }
+    free(a);
+}
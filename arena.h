@@ -0,0 +1,70 @@
+#ifndef __ARENA_H
+#define __ARENA_H
+
+#include <stddef.h>
+
+/*
+ * Declaration of a memory arena for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * An arena hands out memory from large blocks. Individual allocations
+ * are never freed; instead all memory is released at once by
+ * arena_reset() or arena_kill(), in time proportional to the number
+ * of blocks rather than the number of allocations.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+typedef struct arena arena;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * arena_empty() - Create an empty arena.
+ * @block_size: Size in bytes of each block, or 0 for a default size.
+ *
+ * No memory is allocated for blocks until the first arena_alloc().
+ *
+ * Returns: A pointer to the new arena.
+ */
+arena *arena_empty(size_t block_size);
+
+/**
+ * arena_alloc() - Allocate memory from an arena.
+ * @a: Arena to allocate from.
+ * @size: Number of bytes to allocate.
+ *
+ * The memory is suitably aligned for any type. Requests larger than
+ * the block size get a block of their own.
+ *
+ * Returns: A pointer to the allocated memory, valid until the arena
+ *          is reset or killed.
+ */
+void *arena_alloc(arena *a, size_t size);
+
+/**
+ * arena_reset() - Release all allocations in an arena.
+ * @a: Arena to reset.
+ *
+ * The blocks are kept and reused by later allocations.
+ *
+ * Returns: Nothing.
+ */
+void arena_reset(arena *a);
+
+/**
+ * arena_kill() - Destroy an arena.
+ * @a: Arena to destroy.
+ *
+ * Return all dynamic memory used by the arena, including all memory
+ * handed out by arena_alloc().
+ *
+ * Returns: Nothing.
+ */
+void arena_kill(arena *a);
+
+#endif
@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "arena.h"
+
+/**
+ * arena_test.c - Tests for the memory arena.
+ *
+ * This file contains tests for the arena declared in arena.h. Each
+ * test terminates the program with an error message if it fails. Run
+ * under valgrind or AddressSanitizer to detect leaks and out-of-bounds
+ * accesses.
+ *
+ * Compile with: gcc -std=c11 arena_test.c arena.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ */
+
+/**
+ * alloc_test() - Test that allocations are aligned and disjoint.
+ *
+ * Makes allocations of varying sizes over several small blocks,
+ * including one larger than a block, fills each with a pattern and
+ * checks that no pattern was overwritten.
+ */
+void alloc_test(void)
+{
+    fprintf(stderr, "Starting alloc_test()...");
+
+    int n = 200;
+    arena *a = arena_empty(256);
+    unsigned char *p[200];
+
+    for (int i = 0; i < n; i++) {
+        size_t size = i == n / 2 ? 1000 : (size_t)i % 40 + 1;
+        p[i] = arena_alloc(a, size);
+        if ((uintptr_t)p[i] % _Alignof(max_align_t) != 0) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: allocation %d is not aligned.\n", i);
+            exit(EXIT_FAILURE);
+        }
+        memset(p[i], i, size);
+    }
+    for (int i = 0; i < n; i++) {
+        size_t size = i == n / 2 ? 1000 : (size_t)i % 40 + 1;
+        for (size_t j = 0; j < size; j++) {
+            if (p[i][j] != (unsigned char)i) {
+                // Fail with error message
+                fprintf(stderr, "FAIL: allocation %d was overwritten.\n", i);
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    fprintf(stderr, "Test succeeded: %d allocations were aligned and disjoint.\n", n);
+    arena_kill(a);
+}
+
+/**
+ * reset_test() - Test that arena_reset reuses the blocks.
+ *
+ * The first allocation after a reset should get the same memory as
+ * the first allocation before it.
+ */
+void reset_test(void)
+{
+    fprintf(stderr, "Starting reset_test()...");
+
+    arena *a = arena_empty(0);
+    void *first = arena_alloc(a, 16);
+    for (int i = 0; i < 10000; i++) {
+        arena_alloc(a, 24);
+    }
+    arena_reset(a);
+
+    if (arena_alloc(a, 16) != first) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: arena_reset did not reuse the first block.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: arena_reset reused the blocks.\n");
+    arena_kill(a);
+}
+
+int main(void)
+{
+    alloc_test();       // Test arena_alloc
+    reset_test();       // Test arena_reset
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
@@ -7,7 +7,16 @@
 #include <table.h>
 #include <array_1d.h>
 
-#define MAXSIZE 80000
+#include "table_ext.h"
+
+// Initial number of slots in the entry array.
+#define INITIAL_SIZE 16
+
+// Maximum number of entries moved from the old to the new entry array
+// by each table operation while a resize is in progress. Must be at
+// least 1 to guarantee that a resize is finished before the next one
+// is triggered.
+#define MIGRATE_STEP 4
 
 /*
  * Implementation of a generic table for the "Datastructures and
@@ -16,6 +25,17 @@
  *
  * Duplicates are handled by inspect and remove.
  *
+ * The entry array grows by doubling when full. To avoid a single
+ * insert paying for copying the whole array, the old and new arrays
+ * coexist during a resize and every table operation moves at most
+ * MIGRATE_STEP entries from the old array to the new one. Entries
+ * with an index in [migrated, old_size) are still stored in the old
+ * array, all other entries are stored in the new array.
+ *
+ * Since table_lookup() also moves entries, it modifies the table even
+ * though it takes a const table pointer. A shared table needs a lock
+ * around lookups as well as around inserts and removes.
+ *
  * Authors: Niclas Borlin (niclas@cs.umu.se)
  *          Adam Dahlgren Lindstrom (dali@cs.umu.se)
  *
@@ -27,12 +47,18 @@
  *   v1.2  2019-03-04: Bugfix in table_remove.
  *   v1.3  2024-04-15: Added table_print_internal.
  *   v2.0  2024-05-10: Updated print_internal with improved encapsulation.
+ *   v2.1  2026-10-18: Growable entry array with incremental migration.
+ *   v2.2  2026-10-18: Added table_update from table_ext.h.
+ *   v2.3  2026-10-18: Documented that table_lookup modifies the table.
  */
 
 // ===========INTERNAL DATA TYPES ============
 
 struct table {
-    array_1d *entries; // The table entries are stored in a directed list
+    array_1d *entries; // The table entries are stored in an array
+    array_1d *old_entries; // Previous array during a resize, otherwise NULL
+    int old_size; // Number of slots in old_entries
+    int migrated; // Number of entries moved from old_entries so far
     compare_function *key_cmp_func;
     kill_function key_kill_func;
     kill_function value_kill_func;
@@ -80,6 +106,118 @@ void table_entry_kill(void *v)
     free(e);
 }
 
+/**
+ * entry_array() - Return the array that currently holds a given index.
+ * @t: Table to inspect.
+ * @i: Entry index.
+ *
+ * Returns: The old array if the entry at index i has not been
+ * migrated yet, otherwise the current array.
+ */
+static array_1d *entry_array(const table *t, int i)
+{
+    if (t->old_entries != NULL && i >= t->migrated && i < t->old_size) {
+        return t->old_entries;
+    }
+    return t->entries;
+}
+
+// Internal function to return the entry at index i.
+static table_entry *entry_at(const table *t, int i)
+{
+    return array_1d_inspect_value(entry_array(t, i), i);
+}
+
+// Internal function to store the entry e at index i.
+static void set_entry(table *t, table_entry *e, int i)
+{
+    array_1d_set_value(entry_array(t, i), e, i);
+}
+
+/**
+ * migrate_entries() - Move a bounded number of entries to the new array.
+ * @t: Table to manipulate.
+ * @n: Maximum number of entries to move.
+ *
+ * Moves at most n entries from the old to the new array. When all
+ * entries have been moved, the old array is deallocated.
+ *
+ * Returns: Nothing.
+ */
+static void migrate_entries(table *t, int n)
+{
+    if (t->old_entries == NULL) {
+        return;
+    }
+
+    // Entries above first_free_pos may have been removed during the resize.
+    int end = t->old_size < t->first_free_pos ? t->old_size : t->first_free_pos;
+
+    while (t->migrated < end && n > 0) {
+        table_entry *e = array_1d_inspect_value(t->old_entries, t->migrated);
+        array_1d_set_value(t->entries, e, t->migrated);
+        t->migrated++;
+        n--;
+    }
+
+    if (t->migrated >= end) {
+        // Resize finished. The entries are owned by the new array.
+        array_1d_kill(t->old_entries);
+        t->old_entries = NULL;
+    }
+}
+
+/**
+ * grow_entries() - Start a resize of the entry array.
+ * @t: Table to manipulate.
+ *
+ * Allocates a new array with twice the number of slots. No entries
+ * are copied here; they are moved by later calls to migrate_entries().
+ *
+ * Returns: Nothing.
+ */
+static void grow_entries(table *t)
+{
+    // A pending resize is normally finished long before the array is
+    // full again. Finish it now to never have more than two arrays.
+    while (t->old_entries != NULL) {
+        migrate_entries(t, t->old_size);
+    }
+
+    int size = array_1d_high(t->entries) + 1;
+
+    t->old_entries = t->entries;
+    t->old_size = size;
+    t->migrated = 0;
+    t->entries = array_1d_create(0, 2 * size - 1, NULL);
+}
+
+/**
+ * append_entry() - Add a new entry after the last one.
+ * @t: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * The caller has checked that the key is not in the table.
+ *
+ * Returns: Nothing.
+ */
+static void append_entry(table *t, void *key, void *value)
+{
+    // Start a resize if the array is full
+    if (t->first_free_pos > array_1d_high(t->entries))
+    {
+        grow_entries(t);
+    }
+
+    //create table entry
+    table_entry *e = table_entry_create(key, value);
+
+    // Set pointer to table entry in array, increment first_free_pos
+    set_entry(t, e, t->first_free_pos);
+    t->first_free_pos++;
+}
+
 /**
  * table_empty() - Create an empty table.
  * @key_cmp_func: A pointer to a function to be used to compare keys.
@@ -95,17 +233,18 @@ table *table_empty(compare_function *key_cmp_func,
                    kill_function value_kill_func)
 {
     // Allocate memory for table
-    table *t = malloc(sizeof(table));
+    table *t = calloc(1, sizeof(table));
 
-    // Create list to hold the table entries
-    t->entries = array_1d_create(0, MAXSIZE-1, NULL);
+    // Create array to hold the table entries
+    t->entries = array_1d_create(0, INITIAL_SIZE-1, NULL);
+    t->old_entries = NULL;
     t->first_free_pos = 0;
 
     // Store the key compare function and key/value kill functions.
     t->key_cmp_func = key_cmp_func;
     t->key_kill_func = key_kill_func;
     t->value_kill_func = value_kill_func;
-    
+
     return t;
 }
 
@@ -135,49 +274,34 @@ bool table_is_empty(const table *t)
  */
 
 void table_insert(table *t, void *key, void *value) {
-    // Initiate index
-    int i = 0;
+    // Advance any ongoing resize
+    migrate_entries(t, MIGRATE_STEP);
 
     // Search for key matches
-    while(array_1d_inspect_value(t->entries, i) != NULL)
+    for (int i = 0; i < t->first_free_pos; i++)
     {
-        table_entry *e = array_1d_inspect_value(t->entries, i);
-    
+        table_entry *e = entry_at(t, i);
+
         if(t->key_cmp_func(e->key, key) == 0)
         {
             // Free alloceated memory
-            if (t->key_kill_func != NULL) 
+            if (t->key_kill_func != NULL)
             {
-				t->key_kill_func(e->key);		
+				t->key_kill_func(e->key);
 			}
-            if (t->value_kill_func != NULL) 
+            if (t->value_kill_func != NULL)
             {
-				t->value_kill_func(e->value);	
+				t->value_kill_func(e->value);
 			}
 
             // Set pointer to new key and value
             e->key = key;
 			e->value = value;
-            return;      
+            return;
         }
-        
-        i++;
     }
 
-    // Increment first_free_pos
-    t->first_free_pos++;	 
-    if(t->first_free_pos > MAXSIZE)
-    {
-        return;
-    }
-
-     //create table entry
-     table_entry *e = table_entry_create(key, value);
-        
-     // Set pointer to table entry in array, increment first_free_pos
-     array_1d_set_value(t->entries, e, i);   
-     
-     
+    append_entry(t, key, value);
 }
 
 /**
@@ -188,28 +312,75 @@ void table_insert(table *t, void *key, void *value) {
  * Returns: The value corresponding to a given key, or NULL if the key
  * is not found in the table. If the table contains duplicate keys,
  * the value that was latest inserted will be returned.
+ *
+ * Advances an ongoing resize, so concurrent calls on the same table
+ * are not allowed, even though they do not change its contents.
  */
 void *table_lookup(const table *t, const void *key)
 {
-    // Initiate index 
-    int i = 0;
+    // Advance any ongoing resize. This only moves entries between
+    // the internal arrays and does not change the table contents.
+    migrate_entries((table *)t, MIGRATE_STEP);
 
     // Search for key matches
-    while(array_1d_inspect_value(t->entries, i) != NULL)
+    for (int i = 0; i < t->first_free_pos; i++)
     {
-        table_entry *e = array_1d_inspect_value(t->entries, i);
-    
+        table_entry *e = entry_at(t, i);
+
         if(t->key_cmp_func(e->key, key) == 0)
         {
-            return e->value;      
+            return e->value;
         }
-        i++;
     }
 
     //no matches found
     return NULL;
 }
 
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * See table_ext.h. An absent key is appended without searching the
+ * array a second time.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx)
+{
+    // Advance any ongoing resize
+    migrate_entries(t, MIGRATE_STEP);
+
+    // Search for key matches
+    for (int i = 0; i < t->first_free_pos; i++)
+    {
+        table_entry *e = entry_at(t, i);
+
+        if (t->key_cmp_func(e->key, key) == 0)
+        {
+            void *value = fn(e->value, true, ctx);
+            if (value != e->value && t->value_kill_func != NULL)
+            {
+                t->value_kill_func(e->value);
+            }
+            e->value = value;
+            return value;
+        }
+    }
+
+    // No match found. Append the new value, if any.
+    void *value = fn(NULL, false, ctx);
+    if (value != NULL)
+    {
+        append_entry(t, key, value);
+    }
+    return value;
+}
+
 /**
  * table_choose_key() - Return an arbitrary key.
  * @t: Table to inspect.
@@ -223,7 +394,7 @@ void *table_lookup(const table *t, const void *key)
 void *table_choose_key(const table *t)
 {
     // Return top key value.
-    table_entry *e = array_1d_inspect_value(t->entries, t->first_free_pos-1);
+    table_entry *e = entry_at(t, t->first_free_pos-1);
     return e->key;
 }
 
@@ -240,46 +411,45 @@ void *table_choose_key(const table *t)
  */
 void table_remove(table *t, const void *key)
 {
-    // Initiate index
-	int i = 0;	
+    // Advance any ongoing resize
+    migrate_entries(t, MIGRATE_STEP);
 
     // Search for key match
-	while (array_1d_inspect_value(t->entries, i) != NULL && i < MAXSIZE) 
-    {	
+	for (int i = 0; i < t->first_free_pos; i++)
+    {
         // Inspect table entry
-		table_entry *e= array_1d_inspect_value(t->entries, i);
-		
+		table_entry *e = entry_at(t, i);
+
 		// If key match is found, remove entry
-		if ((t->key_cmp_func(e->key, key)) == 0) 
+		if ((t->key_cmp_func(e->key, key)) == 0)
         {
 			// Deallocate memory for key/value pair
-			if (t->key_kill_func != NULL) 
+			if (t->key_kill_func != NULL)
             {
 				t->key_kill_func(e->key);
 			}
-			if (t->value_kill_func != NULL) 
+			if (t->value_kill_func != NULL)
             {
 				t->value_kill_func(e->value);
 			}
 
 			// Pointer to last entry in array
-			table_entry *last_e = array_1d_inspect_value(t->entries, t->first_free_pos-1);
-		
+			table_entry *last_e = entry_at(t, t->first_free_pos-1);
+
             // Move last entry to fill empty array slot
 			e->key = last_e->key;
 			e->value = last_e->value;
-			
+
             // Deallocate memory for last array slot
-			array_1d_set_value(t->entries, NULL, t->first_free_pos-1);
+			set_entry(t, NULL, t->first_free_pos-1);
 			table_entry_kill(last_e);
-			
+
 			// Decrement first_free_pos
 			t->first_free_pos--;
             return;
         }
-        i++;
     }
-}   
+}
 
 /*
  * table_kill() - Destroy a table.
@@ -294,28 +464,28 @@ void table_remove(table *t, const void *key)
  */
 void table_kill(table *t)
 {
-    // Initiate index
-    int i = 0;	
-
-	while (array_1d_inspect_value(t->entries, i) != NULL && i < MAXSIZE) 
+	for (int i = 0; i < t->first_free_pos; i++)
     {
-        table_entry *e = array_1d_inspect_value(t->entries, i);
-		
+        table_entry *e = entry_at(t, i);
+
 		// Deallocate key/value
-		if (t->key_kill_func != NULL) 
+		if (t->key_kill_func != NULL)
         {
 				t->key_kill_func(e->key);
 		}
-		if (t->value_kill_func != NULL) 
+		if (t->value_kill_func != NULL)
         {
 			t->value_kill_func(e->value);
 		}
 
 		// Free table entry
 		free(e);
-		i++;
 	}
 	// Destroy the rest of the table structure
+    if (t->old_entries != NULL)
+    {
+        array_1d_kill(t->old_entries);
+    }
 	array_1d_kill(t->entries);
 	free(t);
 }
@@ -332,16 +502,11 @@ void table_kill(table *t)
  */
 void table_print(const table *t, inspect_callback_pair print_func)
 {
-    // Initiate index
-    int i = 0;
-
     // Iterate over entries and print
-	while (array_1d_inspect_value(t->entries, i) != NULL && i < MAXSIZE) 
-    {	
-		table_entry *e = array_1d_inspect_value(t->entries, i);	
+	for (int i = 0; i < t->first_free_pos; i++)
+    {
+		table_entry *e = entry_at(t, i);
 		print_func(e->key, e->value);
-
-        i++;
 	}
 }
 
@@ -0,0 +1,1182 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h> // For isspace()
+#include <stdarg.h>
+
+#include <table.h>
+
+#include "table_ext.h"
+
+// Smallest number of searches in a window. A window also lasts at
+// least as many searches as the table has entries, so that the O(n)
+// cost of a layout change is amortized over the window.
+#define WINDOW_MIN 256
+
+// A layout change is only made if the new layout is estimated to cost
+// less than SWITCH_MARGIN times the current one. This keeps a table
+// whose costs are close from changing back and forth.
+#define SWITCH_MARGIN 0.75
+
+// Cost of the steps of the layouts, in units of one compare in an
+// array search. A list step also follows a pointer to a node that is
+// usually not in the cache. A hash search computes the hash value and
+// probes a slot before it compares any key.
+#define ARRAY_STEP_COST 1.0
+#define LIST_STEP_COST 2.0
+#define HASH_SEARCH_COST 4.0
+
+// Initial number of slots of the array layout.
+#define ARRAY_MIN 16
+
+// Smallest number of slots of the hash layout. Must be a power of two.
+#define HASH_MIN 64
+
+// Marks a used slot of the hash layout. It is or:ed into the stored
+// hash value, so an unused slot has hash 0.
+#define USED_BIT (1UL << (8 * sizeof(unsigned long) - 1))
+
+/*
+ * Implementation of a generic table for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The table chooses its own layout from the workload. It is stored
+ * in one of three layouts:
+ *  - A linked list in move-to-front order, as mtftable.c. Cheapest
+ *    when a few keys get most of the searches.
+ *  - An array searched linearly, as arraytable.c. Cheapest for small
+ *    tables with no skew.
+ *  - An open addressing hash table with linear probing, as
+ *    hybridtable.c. Cheapest for large tables. Only tables created
+ *    with table_empty_hashed() from table_ext.h can use it.
+ *
+ * Every search (lookup, insert, remove, update) is counted in a
+ * window. The table records if the key was found and how many
+ * compares the search made in the current layout, and estimates what
+ * the search would have cost in the other layouts:
+ *  - List: a hit costs the number of searches since the key was last
+ *    searched for, at most the size. This is the move-to-front depth
+ *    if no key was searched for twice in between, and an upper bound
+ *    otherwise. Skewed workloads give small depths.
+ *  - Array: a hit costs half the size, a miss the size.
+ *  - Hash: one compare for a hit, none for a miss, plus the cost of
+ *    the hash value.
+ * When the window ends, the cost per search of each layout is
+ * computed from the step costs above, and the table moves all
+ * entries to the cheapest layout if it is cheap enough. The result
+ * is available from table_get_stats(). A table starts as an array.
+ *
+ * Inserting a key that is already in the table replaces its key and
+ * value, so the table holds no duplicates.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct slot {
+    void *key;
+    void *value;
+    unsigned long hash; // In the hash layout: hash value or:ed with USED_BIT, 0 if unused
+    long stamp; // Search count when the key was last searched for
+} slot;
+
+typedef struct node {
+    slot s;
+    struct node *next;
+} node;
+
+// Counters of the current window.
+typedef struct window {
+    long searches;
+    long hits;
+    double hit_steps; // Compares made by hits in the current layout
+    double steps[TABLE_LAYOUTS]; // Compares measured or estimated for each layout
+} window;
+
+struct table {
+    table_layout layout;
+    node *list; // The list layout
+    slot *slots; // The array layout, or the slots of the hash layout
+    int n_slots; // Number of slots, a power of two in the hash layout
+    int size; // Number of entries
+    int choose_hint; // Slot where table_choose_key() starts to search
+    long now; // Number of searches, used to stamp the entries
+    window w;
+    table_stats stats;
+    compare_function *key_cmp_func;
+    hash_function *key_hash_func;
+    kill_function key_kill_func;
+    kill_function value_kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+// Internal function to compute the stored hash value of a key.
+static unsigned long slot_hash(const table *t, const void *key)
+{
+    return t->key_hash_func(key) | USED_BIT;
+}
+
+// Internal function to return the index mask of the hash layout.
+static int slot_mask(const table *t)
+{
+    return t->n_slots - 1;
+}
+
+/**
+ * record() - Count a search in the window.
+ * @t: Table that was searched.
+ * @s: The slot of the key, or NULL if the key was not found.
+ * @steps: Number of compares made by the search.
+ *
+ * Returns: Nothing.
+ */
+static void record(table *t, slot *s, int steps)
+{
+    window *w = &t->w;
+    double est[TABLE_LAYOUTS] = {
+        [TABLE_LAYOUT_LIST] = t->size,
+        [TABLE_LAYOUT_ARRAY] = t->size,
+        [TABLE_LAYOUT_HASH] = 0,
+    };
+
+    t->now++;
+    w->searches++;
+    if (s != NULL) {
+        long since = t->now - s->stamp;
+        est[TABLE_LAYOUT_LIST] = since < t->size ? since : t->size;
+        est[TABLE_LAYOUT_ARRAY] = (t->size + 1) / 2.0;
+        est[TABLE_LAYOUT_HASH] = 1;
+        s->stamp = t->now;
+        w->hits++;
+        w->hit_steps += steps;
+    }
+    // The current layout knows its real cost.
+    est[t->layout] = steps;
+
+    for (int l = 0; l < TABLE_LAYOUTS; l++) {
+        w->steps[l] += est[l];
+    }
+}
+
+/**
+ * find() - Find the slot of a key.
+ * @t: Table to search.
+ * @key: Key to search for.
+ * @hash: The stored hash value of the key, if the layout is hashed.
+ *
+ * In the list layout, a found node is moved to the front. The search
+ * is counted in the window.
+ *
+ * Returns: The slot holding the key, or NULL.
+ */
+static slot *find(table *t, const void *key, unsigned long hash)
+{
+    slot *found = NULL;
+    int steps = 0;
+
+    switch (t->layout) {
+    case TABLE_LAYOUT_LIST: {
+        node **link = &t->list;
+        for (node *n = t->list; n != NULL; link = &n->next, n = n->next) {
+            steps++;
+            if (t->key_cmp_func(n->s.key, key) == 0) {
+                // Move to front.
+                *link = n->next;
+                n->next = t->list;
+                t->list = n;
+                found = &n->s;
+                break;
+            }
+        }
+        break;
+    }
+    case TABLE_LAYOUT_ARRAY:
+        for (int i = 0; i < t->size; i++) {
+            steps++;
+            if (t->key_cmp_func(t->slots[i].key, key) == 0) {
+                found = &t->slots[i];
+                break;
+            }
+        }
+        break;
+    case TABLE_LAYOUT_HASH: {
+        int mask = slot_mask(t);
+        for (int i = hash & mask; t->slots[i].hash != 0; i = (i + 1) & mask) {
+            if (t->slots[i].hash == hash) {
+                steps++;
+                if (t->key_cmp_func(t->slots[i].key, key) == 0) {
+                    found = &t->slots[i];
+                    break;
+                }
+            }
+        }
+        break;
+    }
+    }
+
+    record(t, found, steps);
+    return found;
+}
+
+// Internal function to store an entry in the first free slot of its
+// probe sequence in the hash layout. The key must not be in the slots.
+static void place(slot *slots, int mask, const slot *s)
+{
+    int i = s->hash & mask;
+
+    while (slots[i].hash != 0) {
+        i = (i + 1) & mask;
+    }
+    slots[i] = *s;
+}
+
+/**
+ * collect() - Move all entries to a dense array.
+ * @t: Table to empty.
+ *
+ * Frees the storage of the current layout. The list keeps its
+ * move-to-front order, so the most recently used keys come first.
+ *
+ * Returns: An array of t->size entries, to be freed by the caller.
+ */
+static slot *collect(table *t)
+{
+    slot *entries = malloc((t->size > 0 ? t->size : 1) * sizeof(slot));
+    int n = 0;
+
+    switch (t->layout) {
+    case TABLE_LAYOUT_LIST:
+        while (t->list != NULL) {
+            node *next = t->list->next;
+            entries[n++] = t->list->s;
+            free(t->list);
+            t->list = next;
+        }
+        break;
+    case TABLE_LAYOUT_ARRAY:
+        memcpy(entries, t->slots, t->size * sizeof(slot));
+        break;
+    case TABLE_LAYOUT_HASH:
+        for (int i = 0; i < t->n_slots; i++) {
+            if (t->slots[i].hash != 0) {
+                entries[n++] = t->slots[i];
+            }
+        }
+        break;
+    }
+    free(t->slots);
+    t->slots = NULL;
+    t->n_slots = 0;
+    return entries;
+}
+
+/**
+ * build_hash() - Store entries in a hash layout of a given size.
+ * @t: Table to fill, without any storage.
+ * @entries: The entries.
+ * @n: Number of entries.
+ * @n_slots: Number of slots, a power of two larger than n.
+ *
+ * Returns: Nothing.
+ */
+static void build_hash(table *t, slot *entries, int n, int n_slots)
+{
+    t->slots = calloc(n_slots, sizeof(slot));
+    t->n_slots = n_slots;
+    for (int i = 0; i < n; i++) {
+        if (entries[i].hash == 0) {
+            entries[i].hash = slot_hash(t, entries[i].key);
+        }
+        place(t->slots, n_slots - 1, &entries[i]);
+    }
+    t->choose_hint = 0;
+}
+
+/**
+ * migrate() - Move all entries to another layout.
+ * @t: Table to manipulate.
+ * @layout: The new layout.
+ *
+ * Returns: Nothing.
+ */
+static void migrate(table *t, table_layout layout)
+{
+    slot *entries = collect(t);
+    int n = t->size;
+
+    t->layout = layout;
+    switch (layout) {
+    case TABLE_LAYOUT_LIST:
+        for (int i = n - 1; i >= 0; i--) {
+            node *nd = malloc(sizeof(node));
+            nd->s = entries[i];
+            nd->s.hash = 0;
+            nd->next = t->list;
+            t->list = nd;
+        }
+        break;
+    case TABLE_LAYOUT_ARRAY:
+        t->n_slots = n > ARRAY_MIN ? n : ARRAY_MIN;
+        t->slots = malloc(t->n_slots * sizeof(slot));
+        for (int i = 0; i < n; i++) {
+            t->slots[i] = entries[i];
+            t->slots[i].hash = 0;
+        }
+        break;
+    case TABLE_LAYOUT_HASH: {
+        int n_slots = HASH_MIN;
+        while (4 * n > 3 * n_slots) {
+            n_slots *= 2;
+        }
+        for (int i = 0; i < n; i++) {
+            entries[i].hash = 0;
+        }
+        build_hash(t, entries, n, n_slots);
+        break;
+    }
+    }
+    free(entries);
+}
+
+// Internal function to resize the hash layout.
+static void rehash(table *t, int n_slots)
+{
+    slot *entries = collect(t);
+
+    build_hash(t, entries, t->size, n_slots);
+    free(entries);
+}
+
+/**
+ * end_search() - Close the window if it is complete.
+ * @t: Table to manipulate.
+ *
+ * Called after each operation, when no slot pointers are in use.
+ * Computes the cost of each layout and moves the table to the
+ * cheapest one if it is cheap enough.
+ *
+ * Returns: Nothing.
+ */
+static void end_search(table *t)
+{
+    window *w = &t->w;
+    table_stats *st = &t->stats;
+
+    if (w->searches < WINDOW_MIN || w->searches < t->size) {
+        return;
+    }
+
+    static const double step_cost[TABLE_LAYOUTS] = {
+        [TABLE_LAYOUT_LIST] = LIST_STEP_COST,
+        [TABLE_LAYOUT_ARRAY] = ARRAY_STEP_COST,
+        [TABLE_LAYOUT_HASH] = ARRAY_STEP_COST,
+    };
+    table_layout best = t->layout;
+    for (int l = 0; l < TABLE_LAYOUTS; l++) {
+        st->cost[l] = step_cost[l] * w->steps[l] / w->searches;
+    }
+    st->cost[TABLE_LAYOUT_HASH] += HASH_SEARCH_COST;
+    for (int l = 0; l < TABLE_LAYOUTS; l++) {
+        if (l == TABLE_LAYOUT_HASH && t->key_hash_func == NULL) {
+            continue;
+        }
+        if (st->cost[l] < st->cost[best]) {
+            best = l;
+        }
+    }
+    st->hit_ratio = (double)w->hits / w->searches;
+    st->hit_depth = w->hits > 0 ? w->hit_steps / w->hits : 0;
+    st->windows++;
+
+    if (best != t->layout && st->cost[best] < SWITCH_MARGIN * st->cost[t->layout]) {
+        migrate(t, best);
+        st->switches++;
+    }
+    st->layout = t->layout;
+    memset(w, 0, sizeof(*w));
+}
+
+/**
+ * add_entry() - Add an entry for a key that is not in the table.
+ * @t: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ * @hash: The stored hash value of the key, if the layout is hashed.
+ *
+ * Returns: Nothing.
+ */
+static void add_entry(table *t, void *key, void *value, unsigned long hash)
+{
+    slot s = { .key = key, .value = value, .hash = hash, .stamp = t->now };
+
+    switch (t->layout) {
+    case TABLE_LAYOUT_LIST: {
+        node *n = malloc(sizeof(node));
+        n->s = s;
+        n->next = t->list;
+        t->list = n;
+        break;
+    }
+    case TABLE_LAYOUT_ARRAY:
+        if (t->size == t->n_slots) {
+            t->n_slots *= 2;
+            t->slots = realloc(t->slots, t->n_slots * sizeof(slot));
+        }
+        t->slots[t->size] = s;
+        break;
+    case TABLE_LAYOUT_HASH:
+        if (4 * (t->size + 1) > 3 * t->n_slots) {
+            rehash(t, 2 * t->n_slots);
+        }
+        place(t->slots, slot_mask(t), &s);
+        break;
+    }
+    t->size++;
+}
+
+/**
+ * remove_slot() - Remove the entry in a slot found by find().
+ * @t: Table to manipulate.
+ * @s: The slot.
+ *
+ * Returns: Nothing.
+ */
+static void remove_slot(table *t, slot *s)
+{
+    t->size--;
+    switch (t->layout) {
+    case TABLE_LAYOUT_LIST: {
+        // find() has moved the node to the front.
+        node *n = t->list;
+        t->list = n->next;
+        free(n);
+        break;
+    }
+    case TABLE_LAYOUT_ARRAY:
+        *s = t->slots[t->size];
+        break;
+    case TABLE_LAYOUT_HASH: {
+        int mask = slot_mask(t);
+        int hole = s - t->slots;
+        for (int j = (hole + 1) & mask; t->slots[j].hash != 0; j = (j + 1) & mask) {
+            // The entry at j may fill the hole if its home slot is not
+            // in the cyclic range (hole, j].
+            int home = t->slots[j].hash & mask;
+            if (((j - home) & mask) >= ((j - hole) & mask)) {
+                t->slots[hole] = t->slots[j];
+                hole = j;
+            }
+        }
+        t->slots[hole].hash = 0;
+        if (t->n_slots > HASH_MIN && 8 * t->size < t->n_slots) {
+            rehash(t, t->n_slots / 2);
+        }
+        break;
+    }
+    }
+}
+
+// Internal function to compute the hash value needed by find().
+static unsigned long search_hash(const table *t, const void *key)
+{
+    return t->layout == TABLE_LAYOUT_HASH ? slot_hash(t, key) : 0;
+}
+
+// ==========INTERFACE==========
+
+/**
+ * table_empty() - Create an empty table.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * The table only chooses between the list and array layouts. Use
+ * table_empty_hashed() to allow the hash layout.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty(compare_function *key_cmp_func,
+                   kill_function key_kill_func,
+                   kill_function value_kill_func)
+{
+    return table_empty_hashed(key_cmp_func, NULL, key_kill_func, value_kill_func);
+}
+
+/**
+ * table_empty_hashed() - Create an empty table that may hash its keys.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function to be used to hash keys, or
+ *                 NULL to never use the hash layout.
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_hashed(compare_function *key_cmp_func,
+                          hash_function *key_hash_func,
+                          kill_function key_kill_func,
+                          kill_function value_kill_func)
+{
+    table *t = calloc(1, sizeof(table));
+
+    t->layout = TABLE_LAYOUT_ARRAY;
+    t->slots = malloc(ARRAY_MIN * sizeof(slot));
+    t->n_slots = ARRAY_MIN;
+    t->stats.layout = t->layout;
+
+    // Store the key compare and hash functions and key/value kill functions.
+    t->key_cmp_func = key_cmp_func;
+    t->key_hash_func = key_hash_func;
+    t->key_kill_func = key_kill_func;
+    t->value_kill_func = value_kill_func;
+
+    return t;
+}
+
+/**
+ * table_is_empty() - Check if a table is empty.
+ * @table: Table to check.
+ *
+ * Returns: True if table contains no key/value pairs, false otherwise.
+ */
+bool table_is_empty(const table *t)
+{
+    return t->size == 0;
+}
+
+/**
+ * table_insert() - Add a key/value pair to a table.
+ * @table: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Insert the key/value pair into the table. If the key is already in
+ * the table, its old key and value are de-allocated with the kill
+ * functions and replaced.
+ *
+ * Returns: Nothing.
+ */
+void table_insert(table *t, void *key, void *value)
+{
+    unsigned long hash = search_hash(t, key);
+    slot *s = find(t, key, hash);
+
+    if (s != NULL) {
+        if (t->key_kill_func != NULL && s->key != key) {
+            t->key_kill_func(s->key);
+        }
+        if (t->value_kill_func != NULL && s->value != value) {
+            t->value_kill_func(s->value);
+        }
+        s->key = key;
+        s->value = value;
+    } else {
+        add_entry(t, key, value, hash);
+    }
+    end_search(t);
+}
+
+/**
+ * table_lookup() - Look up a given key in a table.
+ * @table: Table to inspect.
+ * @key: Key to look up.
+ *
+ * The table may reorder or change its layout, as mtftable.c reorders
+ * on lookup.
+ *
+ * Returns: The value corresponding to a given key, or NULL if the key
+ * is not found in the table.
+ */
+void *table_lookup(const table *t, const void *key)
+{
+    table *mt = (table *)t;
+    slot *s = find(mt, key, search_hash(t, key));
+    void *value = s != NULL ? s->value : NULL;
+
+    end_search(mt);
+    return value;
+}
+
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * See table_ext.h.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx)
+{
+    unsigned long hash = search_hash(t, key);
+    slot *s = find(t, key, hash);
+    void *value;
+
+    if (s != NULL) {
+        value = fn(s->value, true, ctx);
+        if (value != s->value && t->value_kill_func != NULL) {
+            t->value_kill_func(s->value);
+        }
+        s->value = value;
+    } else {
+        value = fn(NULL, false, ctx);
+        if (value != NULL) {
+            add_entry(t, key, value, hash);
+        }
+    }
+    end_search(t);
+    return value;
+}
+
+/**
+ * table_choose_key() - Return an arbitrary key.
+ * @t: Table to inspect.
+ *
+ * Return an arbitrary key stored in the table. Can be used together
+ * with table_remove() to deconstruct the table. Undefined for an
+ * empty table.
+ *
+ * Returns: An arbitrary key stored in the table.
+ */
+void *table_choose_key(const table *t)
+{
+    switch (t->layout) {
+    case TABLE_LAYOUT_LIST:
+        return t->list->s.key;
+    case TABLE_LAYOUT_ARRAY:
+        return t->slots[t->size - 1].key;
+    case TABLE_LAYOUT_HASH:
+        // Start where the last search ended, to make repeated
+        // choose/remove linear in the number of slots.
+        for (int n = 0; n < t->n_slots; n++) {
+            int i = (t->choose_hint + n) & slot_mask(t);
+            if (t->slots[i].hash != 0) {
+                ((table *)t)->choose_hint = i;
+                return t->slots[i].key;
+            }
+        }
+        break;
+    }
+    return NULL;
+}
+
+/**
+ * table_remove() - Remove a key/value pair in the table.
+ * @table: Table to manipulate.
+ * @key: Key for which to remove pair.
+ *
+ * Will call any kill functions set for keys/values. Does nothing if
+ * key is not found in the table.
+ *
+ * Returns: Nothing.
+ */
+void table_remove(table *t, const void *key)
+{
+    slot *s = find(t, key, search_hash(t, key));
+
+    if (s != NULL) {
+        // Remove the slot first, since key may point to the stored key.
+        slot old = *s;
+        remove_slot(t, s);
+
+        if (t->key_kill_func != NULL) {
+            t->key_kill_func(old.key);
+        }
+        if (t->value_kill_func != NULL) {
+            t->value_kill_func(old.value);
+        }
+    }
+    end_search(t);
+}
+
+/*
+ * table_kill() - Destroy a table.
+ * @table: Table to destroy.
+ *
+ * Return all dynamic memory used by the table and its elements. If a
+ * kill_func was registered for keys and/or values at table creation,
+ * it is called each element to kill any user-allocated memory
+ * occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void table_kill(table *t)
+{
+    slot *entries = collect(t);
+
+    for (int i = 0; i < t->size; i++) {
+        if (t->key_kill_func != NULL) {
+            t->key_kill_func(entries[i].key);
+        }
+        if (t->value_kill_func != NULL) {
+            t->value_kill_func(entries[i].value);
+        }
+    }
+    free(entries);
+    free(t);
+}
+
+/**
+ * table_print() - Print the given table.
+ * @t: Table to print.
+ * @print_func: Function called for each key/value pair in the table.
+ *
+ * Iterates over the key/value pairs in the table and prints them.
+ *
+ * Returns: Nothing.
+ */
+void table_print(const table *t, inspect_callback_pair print_func)
+{
+    switch (t->layout) {
+    case TABLE_LAYOUT_LIST:
+        for (const node *n = t->list; n != NULL; n = n->next) {
+            print_func(n->s.key, n->s.value);
+        }
+        break;
+    case TABLE_LAYOUT_ARRAY:
+        for (int i = 0; i < t->size; i++) {
+            print_func(t->slots[i].key, t->slots[i].value);
+        }
+        break;
+    case TABLE_LAYOUT_HASH:
+        for (int i = 0; i < t->n_slots; i++) {
+            if (t->slots[i].hash != 0) {
+                print_func(t->slots[i].key, t->slots[i].value);
+            }
+        }
+        break;
+    }
+}
+
+/**
+ * table_get_stats() - Get the statistics of a self-tuning table.
+ * @t: Table to inspect.
+ *
+ * Returns: The statistics.
+ */
+table_stats table_get_stats(const table *t)
+{
+    table_stats st = t->stats;
+
+    st.searches = t->now;
+    return st;
+}
+
+// ===========INTERNAL FUNCTIONS USED BY table_print_internal ============
+
+// The functions below output code in the dot language, used by
+// GraphViz. For documention of the dot language, see graphviz.org.
+
+/**
+ * indent() - Output indentation string.
+ * @n: Indentation level.
+ *
+ * Print n tab characters.
+ *
+ * Returns: Nothing.
+ */
+static void indent(int n)
+{
+    for (int i=0; i<n; i++) {
+        printf("\t");
+    }
+}
+
+/**
+ * iprintf(...) - Indent and print.
+ * @n: Indentation level
+ * @...: printf arguments
+ *
+ * Print n tab characters and calls printf.
+ *
+ * Returns: Nothing.
+ */
+static void iprintf(int n, const char *fmt, ...)
+{
+    // Indent...
+    indent(n);
+    // ...and call printf
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * print_edge() - Print a edge between two addresses.
+ * @from: The address of the start of the edge. Should be non-NULL.
+ * @to: The address of the destination for the edge, including NULL.
+ * @port: The name of the port on the source node, or NULL.
+ * @label: The label for the edge, or NULL.
+ * @options: A string with other edge options, or NULL.
+ *
+ * Print an edge from port PORT on node FROM to TO with label
+ * LABEL. If to is NULL, the destination is the NULL node, otherwise a
+ * memory node. If the port is NULL, the edge starts at the node, not
+ * a specific port on it. If label is NULL, no label is used. The
+ * options string, if non-NULL, is printed before the label.
+ *
+ * Returns: Nothing.
+ */
+static void print_edge(int indent_level, const void *from, const void *to, const char *port,
+                       const char *label, const char *options)
+{
+    indent(indent_level);
+    if (port) {
+        printf("m%04lx:%s -> ", PTR2ADDR(from), port);
+    } else {
+        printf("m%04lx -> ", PTR2ADDR(from));
+    }
+    if (to == NULL) {
+        printf("NULL");
+    } else {
+        printf("m%04lx", PTR2ADDR(to));
+    }
+    printf(" [");
+    if (options != NULL) {
+        printf("%s", options);
+    }
+    if (label != NULL) {
+        printf(" label=\"%s\"",label);
+    }
+    printf("]\n");
+}
+
+/**
+ * print_head_node() - Print a node corresponding to the table struct.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ *
+ * Returns: Nothing.
+ */
+static void print_head_node(int indent_level, const table *t)
+{
+    static const char *layout_names[TABLE_LAYOUTS] = {
+        [TABLE_LAYOUT_LIST] = "list",
+        [TABLE_LAYOUT_ARRAY] = "array",
+        [TABLE_LAYOUT_HASH] = "hash",
+    };
+
+    iprintf(indent_level, "m%04lx [shape=record "
+            "label=\"layout\\n%s|list\\n%04lx|slots\\n%04lx|n_slots\\n%d|size\\n%d"
+            "|cmp\\n%04lx|hash\\n%04lx|key_kill\\n%04lx|value_kill\\n%04lx\"]\n",
+            PTR2ADDR(t), layout_names[t->layout], PTR2ADDR(t->list), PTR2ADDR(t->slots),
+            t->n_slots, t->size, PTR2ADDR(t->key_cmp_func), PTR2ADDR(t->key_hash_func),
+            PTR2ADDR(t->key_kill_func), PTR2ADDR(t->value_kill_func));
+}
+
+// Internal function to print the key and value nodes in dot format.
+static void print_key_value_nodes(int indent_level, const void *key, const void *value,
+                                  inspect_callback key_print_func,
+                                  inspect_callback value_print_func)
+{
+    if (key != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(key));
+        if (key_print_func != NULL) {
+            key_print_func(key);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(key));
+    }
+    if (value != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(value));
+        if (value_print_func != NULL) {
+            value_print_func(value);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(value));
+    }
+}
+
+/**
+ * print_entry() - Print one entry in dot format.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ * @e: Address of the entry, used as the name of its node.
+ * @i: Position of the entry in the printout.
+ * @key: Key of the entry.
+ * @value: Value of the entry.
+ * @key_print_func: Function called for the key.
+ * @value_print_func: Function called for the value.
+ * @payload: If true, print the key and value nodes, otherwise the
+ *           entry node and its edges.
+ *
+ * The entry is drawn as an edge from the head node labelled with its
+ * position. Memory "owned" by the table is indicated by solid red
+ * lines. Memory "borrowed" from the user is indicated by red dashed
+ * lines.
+ *
+ * Returns: Nothing.
+ */
+static void print_entry(int indent_level, const table *t, const void *e, int i,
+                        const void *key, const void *value,
+                        inspect_callback key_print_func,
+                        inspect_callback value_print_func, bool payload)
+{
+    if (payload) {
+        print_key_value_nodes(indent_level, key, value, key_print_func, value_print_func);
+        return;
+    }
+    char label[16];
+    snprintf(label, sizeof(label), "%d", i);
+
+    iprintf(indent_level, "m%04lx [shape=record label=\"<k>key\\n%04lx|<v>value\\n%04lx\"]\n",
+            PTR2ADDR(e), PTR2ADDR(key), PTR2ADDR(value));
+    print_edge(indent_level, t, e, NULL, label, NULL);
+    if (key == NULL) {
+        print_edge(indent_level, e, key, "k", "key", NULL);
+    } else if (t->key_kill_func) {
+        print_edge(indent_level, e, key, "k", "key", "color=red");
+    } else {
+        print_edge(indent_level, e, key, "k", "key", "color=red style=dashed");
+    }
+    if (value == NULL) {
+        print_edge(indent_level, e, value, "v", "value", NULL);
+    } else if (t->value_kill_func) {
+        print_edge(indent_level, e, value, "v", "value", "color=red");
+    } else {
+        print_edge(indent_level, e, value, "v", "value", "color=red style=dashed");
+    }
+}
+
+// Internal function to print the entries of the current layout in dot
+// format. List nodes are numbered by position, slots by index.
+static void print_entries(int indent_level, const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, bool payload)
+{
+    switch (t->layout) {
+    case TABLE_LAYOUT_LIST: {
+        int i = 0;
+        for (const node *n = t->list; n != NULL; n = n->next) {
+            print_entry(indent_level, t, n, i++, n->s.key, n->s.value,
+                        key_print_func, value_print_func, payload);
+        }
+        break;
+    }
+    case TABLE_LAYOUT_ARRAY:
+        for (int i = 0; i < t->size; i++) {
+            print_entry(indent_level, t, &t->slots[i], i, t->slots[i].key, t->slots[i].value,
+                        key_print_func, value_print_func, payload);
+        }
+        break;
+    case TABLE_LAYOUT_HASH:
+        for (int i = 0; i < t->n_slots; i++) {
+            if (t->slots[i].hash != 0) {
+                print_entry(indent_level, t, &t->slots[i], i, t->slots[i].key,
+                            t->slots[i].value, key_print_func, value_print_func, payload);
+            }
+        }
+        break;
+    }
+}
+
+// Create an escaped version of the input string. The most common
+// control characters - newline, horizontal tab, backslash, and double
+// quote - are replaced by their escape sequence. The returned pointer
+// must be deallocated by the caller.
+static char *escape_chars(const char *s)
+{
+    int i, j;
+    int escaped = 0; // The number of chars that must be escaped.
+
+    // Count how many chars need to be escaped, i.e. how much longer
+    // the output string will be.
+    for (i = escaped = 0; s[i] != '\0'; i++) {
+        if (s[i] == '\n' || s[i] == '\t' || s[i] == '\\' || s[i] == '\"') {
+            escaped++;
+        }
+    }
+    // Allocate space for the escaped string. The variable i holds the input
+    // length, escaped how much the string will grow.
+    char *t = malloc(i + escaped + 1);
+
+    // Copy-and-escape loop
+    for (i = j = 0; s[i] != '\0'; i++) {
+        // Convert each control character by its escape sequence.
+        // Non-control characters are copied as-is.
+        switch (s[i]) {
+        case '\n': t[i+j] = '\\'; t[i+j+1] = 'n';  j++; break;
+        case '\t': t[i+j] = '\\'; t[i+j+1] = 't';  j++; break;
+        case '\\': t[i+j] = '\\'; t[i+j+1] = '\\'; j++; break;
+        case '\"': t[i+j] = '\\'; t[i+j+1] = '\"'; j++; break;
+        default:   t[i+j] = s[i]; break;
+        }
+    }
+    // Terminal the output string
+    t[i+j] = '\0';
+    return t;
+}
+
+/**
+ * first_white_spc() - Return pointer to first white-space char.
+ * @s: String.
+ *
+ * Returns: A pointer to the first white-space char in s, or NULL if none is found.
+ *
+ */
+static const char *find_white_spc(const char *s)
+{
+    const char *t = s;
+    while (*t != '\0') {
+        if (isspace(*t)) {
+            // We found a white-space char, return a point to it.
+            return t;
+        }
+        // Advance to next char
+        t++;
+    }
+    // No white-space found
+    return NULL;
+}
+
+/**
+ * insert_table_name() - Maybe insert the name of the table src file in the description string.
+ * @s: Description string.
+ *
+ * Parses the description string to find of if it starts with a c file
+ * name. In that case, the file name of this file is spliced into the
+ * description string. The parsing is not very intelligent: If the
+ * sequence ".c:" (case insensitive) is found before the first
+ * white-space, the string up to and including ".c" is taken to be a c
+ * file name.
+ *
+ * Returns: A dynamic copy of s, optionally including with the table src file name.
+ */
+static char *insert_table_name(const char *s)
+{
+    // First, determine if the description string starts with a c file name
+    // a) Search for the string ".c:"
+    const char *dot_c = strstr(s, ".c:");
+    // b) Search for the first white-space
+    const char *spc = find_white_spc(s);
+
+    bool prefix_found;
+    int output_length;
+
+    // If both a) and b) are found AND a) is before b, we assume that
+    // s starts with a file name
+    if (dot_c != NULL && spc != NULL && dot_c < spc) {
+        // We found a match. Output string is input + 3 chars + __FILE__
+        prefix_found = true;
+        output_length = strlen(s) + 3 + strlen(__FILE__);
+    } else {
+        // No match found. Output string is just input
+        prefix_found = false;
+        output_length = strlen(s);
+    }
+
+    // Allocate space for the whole string
+    char *out = calloc(1, output_length + 1);
+    strcpy(out, s);
+    if (prefix_found) {
+        // Overwrite the output buffer from the ":"
+        strcpy(out + (dot_c - s + 2), " (");
+        // Now out will be 0-terminated after "(", append the file name and ")"
+        strcat(out, __FILE__);
+        strcat(out, ")");
+        // Finally append the input string from the : onwards
+        strcat(out, dot_c + 2);
+    }
+    return out;
+}
+
+/**
+ * table_print_internal() - Output the internal structure of the table.
+ * @t: Table to print.
+ * @key_print_func: Function called for each key in the table.
+ * @value_print_func: Function called for each value in the table.
+ * @desc: String with a description/state of the list.
+ * @indent_level: Indentation level, 0 for outermost
+ *
+ * Prints code that shows the entries of the current layout, each as
+ * an edge from the table struct labelled with its position in the
+ * list or its slot index. The head node shows the layout.
+ *
+ * Returns: Nothing.
+ */
+void table_print_internal(const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, const char *desc,
+                          int indent_level)
+{
+    static int graph_number = 0;
+    graph_number++;
+    int il = indent_level;
+
+    if (indent_level == 0) {
+        // If this is the outermost datatype, start a graph and set up defaults
+        printf("digraph TABLE_%d {\n", graph_number);
+
+        // Specify default shape and fontname
+        il++;
+        iprintf(il, "node [shape=rectangle fontname=\"Courier New\"]\n");
+        iprintf(il, "ranksep=0.01\n");
+        iprintf(il, "subgraph cluster_nullspace {\n");
+        iprintf(il+1, "NULL\n");
+        iprintf(il, "}\n");
+    }
+
+    if (desc != NULL) {
+        // Escape the string before printout
+        char *escaped = escape_chars(desc);
+        // Optionally, splice the source file name
+        char *spliced = insert_table_name(escaped);
+
+        // Use different names on inner description nodes
+        if (indent_level == 0) {
+            iprintf(il, "description [label=\"%s\"]\n", spliced);
+        } else {
+            iprintf(il, "\tcluster_list_%d_description [label=\"%s\"]\n", graph_number, spliced);
+        }
+        // Return the memory used by the spliced and escaped strings
+        free(spliced);
+        free(escaped);
+    }
+
+    if (indent_level == 0) {
+        // Use a single "pointer" edge as a starting point for the
+        // outermost datatype
+        iprintf(il, "t [label=\"%04lx\" xlabel=\"t\"]\n", PTR2ADDR(t));
+        iprintf(il, "t -> m%04lx\n", PTR2ADDR(t));
+    }
+
+    if (indent_level == 0) {
+        // Put the user nodes in userspace
+        iprintf(il, "subgraph cluster_userspace { label=\"User space\"\n");
+        il++;
+
+        // Print the key and value nodes
+        print_entries(il, t, key_print_func, value_print_func, true);
+
+        // Close the subgraph
+        il--;
+        iprintf(il, "}\n");
+    }
+
+    // Print the subgraph to surround the table content
+    iprintf(il, "subgraph cluster_table_%d { label=\"Table\"\n", graph_number);
+    il++;
+
+    // Output the head node
+    print_head_node(il, t);
+
+    // Output the entries and their edges
+    print_entries(il, t, key_print_func, value_print_func, false);
+
+    // Close the subgraph
+    il--;
+    iprintf(il, "}\n");
+
+    if (indent_level == 0) {
+        // Termination of graph
+        printf("}\n");
+    }
+}
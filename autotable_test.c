@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "table_ext.h"
+#include "int_fixture.h"
+
+/**
+ * autotable_test.c - Tests for the layout decisions of autotable.c.
+ *
+ * This file contains tests that run workloads for which one layout is
+ * clearly cheapest and check, with table_get_stats(), that the table
+ * has moved to it. The contents are checked after every workload, so
+ * an entry lost by a layout change is detected. The plain table.h
+ * operations are covered by table_difftest.c. Each test terminates
+ * the program with an error message if it fails.
+ *
+ * Compile with: gcc -I<include> autotable_test.c autotable.c table_ext.c int_fixture.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Use the helpers of int_fixture.c.
+ */
+
+// Number of searches of each workload, many windows.
+#define SEARCHES 100000
+
+static const char *layout_names[TABLE_LAYOUTS] = { "list", "array", "hash" };
+
+/**
+ * fill() - Create a table of the keys 0..n-1 with values equal to the keys.
+ * @n: Number of keys.
+ * @hash: Hash function of the table, or NULL.
+ *
+ * Returns: The table.
+ */
+static table *fill(int n, hash_function *hash)
+{
+    table *t = table_empty_hashed(compare_int, hash, kill_int, kill_int);
+
+    for (int k = 0; k < n; k++) {
+        table_insert(t, new_int(k), new_int(k));
+    }
+    return t;
+}
+
+/**
+ * run_lookups() - Look up keys with a given skew.
+ * @t: Table of the keys 0..n-1.
+ * @n: Number of keys.
+ * @hot: Number of hot keys, or n for no skew.
+ * @misses: Look up an absent key every misses-th search, or 0.
+ *
+ * 99 of 100 lookups are of the hot keys n-hot..n-1, which are last in
+ * insertion order. Every lookup of a present key must return the key.
+ *
+ * Returns: Nothing.
+ */
+static void run_lookups(table *t, int n, int hot, int misses)
+{
+    unsigned state = 12345;
+
+    for (int i = 1; i <= SEARCHES; i++) {
+        unsigned r = next_random(&state);
+        int k = r % 100 != 0 ? n - 1 - (int)(r / 100 % hot) : (int)(r / 100 % n);
+        if (misses > 0 && i % misses == 0) {
+            k = n + k;
+        }
+        int *v = table_lookup(t, &k);
+        if ((k < n) != (v != NULL) || (v != NULL && *v != k)) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: lookup of %d in a table of %d keys returned %d.\n", k, n,
+                    v == NULL ? -1 : *v);
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/**
+ * expect_layout() - Check the layout of a table.
+ * @t: Table to check.
+ * @layout: The expected layout.
+ * @what: Description of the workload.
+ *
+ * Returns: Nothing.
+ */
+static void expect_layout(const table *t, table_layout layout, const char *what)
+{
+    table_stats st = table_get_stats(t);
+
+    if (st.layout != layout) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: %s gave layout %s, expected %s. Costs: list %.1f, array %.1f, "
+                "hash %.1f.\n", what, layout_names[st.layout], layout_names[layout],
+                st.cost[TABLE_LAYOUT_LIST], st.cost[TABLE_LAYOUT_ARRAY],
+                st.cost[TABLE_LAYOUT_HASH]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * kill_and_check() - Kill a table and check that all keys and values were killed.
+ * @t: Table to kill.
+ *
+ * Returns: Nothing.
+ */
+static void kill_and_check(table *t)
+{
+    table_kill(t);
+    check_ints_killed();
+}
+
+/**
+ * choose_test() - Test that each workload moves the table to its best layout.
+ */
+void choose_test(void)
+{
+    fprintf(stderr, "Starting choose_test()...");
+
+    // Large table, no skew: hashing wins.
+    table *t = fill(2000, hash_int);
+    run_lookups(t, 2000, 2000, 0);
+    expect_layout(t, TABLE_LAYOUT_HASH, "a large uniform table");
+    kill_and_check(t);
+
+    // Large table, two hot keys and no hash function: move-to-front wins.
+    t = fill(2000, NULL);
+    run_lookups(t, 2000, 2, 0);
+    expect_layout(t, TABLE_LAYOUT_LIST, "a large skewed table without hashing");
+    kill_and_check(t);
+
+    // Tiny table, no skew: the array is as good as hashing and stays.
+    t = fill(6, hash_int);
+    run_lookups(t, 6, 6, 0);
+    expect_layout(t, TABLE_LAYOUT_ARRAY, "a tiny uniform table");
+    kill_and_check(t);
+
+    // Large table without a hash function and with many misses: the
+    // list costs more per step than the array.
+    t = fill(2000, NULL);
+    run_lookups(t, 2000, 2000, 2);
+    expect_layout(t, TABLE_LAYOUT_ARRAY, "a large table with misses");
+    kill_and_check(t);
+
+    fprintf(stderr, "Test succeeded: every workload got the expected layout.\n");
+}
+
+/**
+ * phase_test() - Test a table whose workload changes.
+ *
+ * A large table moves to the hash layout, and back to the array when
+ * it shrinks to a few keys. The statistics must count the changes.
+ */
+void phase_test(void)
+{
+    fprintf(stderr, "Starting phase_test()...");
+
+    table *t = fill(2000, hash_int);
+    long switches = 0;
+
+    run_lookups(t, 2000, 2000, 0);
+    expect_layout(t, TABLE_LAYOUT_HASH, "the uniform phase");
+    switches++;
+
+    // Shrink to a tiny table.
+    for (int k = 6; k < 2000; k++) {
+        table_remove(t, &k);
+    }
+    run_lookups(t, 6, 6, 0);
+    expect_layout(t, TABLE_LAYOUT_ARRAY, "the tiny phase");
+    switches++;
+
+    table_stats st = table_get_stats(t);
+    if (st.switches != switches || st.windows < SEARCHES / 256 || st.hit_ratio != 1.0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: the stats show %ld switches in %ld windows and a hit ratio of "
+                "%.2f, expected %ld switches.\n", st.switches, st.windows, st.hit_ratio,
+                switches);
+        exit(EXIT_FAILURE);
+    }
+    kill_and_check(t);
+
+    fprintf(stderr, "Test succeeded: the table followed the workload.\n");
+}
+
+int main(void)
+{
+    choose_test();  // Test the layout of fixed workloads
+    phase_test();   // Test a changing workload
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
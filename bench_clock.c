@@ -0,0 +1,54 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#include "bench_clock.h"
+
+/*
+ * Implementation of the clock helpers shared by the benchmarks.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version, moved from the benchmarks.
+ */
+
+// Number of clock reads clock_overhead() takes the median of.
+#define OVERHEAD_SAMPLES 101
+
+// ==========INTERFACE==========
+
+/**
+ * now_ns() - Read the monotonic clock.
+ *
+ * Returns: The current time in nanoseconds.
+ */
+long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * clock_overhead() - Estimate the cost of reading the clock.
+ *
+ * Returns: The median time in nanoseconds between two back-to-back
+ *          calls to now_ns().
+ */
+long long clock_overhead(void)
+{
+    long long d[OVERHEAD_SAMPLES];
+
+    for (int i = 0; i < OVERHEAD_SAMPLES; i++) {
+        long long t = now_ns();
+        d[i] = now_ns() - t;
+    }
+    // Insertion sort; the array is small.
+    for (int i = 1; i < OVERHEAD_SAMPLES; i++) {
+        for (int j = i; j > 0 && d[j - 1] > d[j]; j--) {
+            long long tmp = d[j];
+            d[j] = d[j - 1];
+            d[j - 1] = tmp;
+        }
+    }
+    return d[OVERHEAD_SAMPLES / 2];
+}
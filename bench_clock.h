@@ -0,0 +1,39 @@
+#ifndef BENCH_CLOCK_H
+#define BENCH_CLOCK_H
+
+/*
+ * Clock helpers shared by the benchmarks.
+ *
+ * Times are read from CLOCK_MONOTONIC in nanoseconds. When single
+ * operations are timed, e.g. into a histogram from histogram.h, the
+ * cost of reading the clock itself is of the same order as the
+ * operation and should be subtracted:
+ *
+ *   long long overhead = clock_overhead();
+ *   ...
+ *   long long start = now_ns();
+ *   table_lookup(t, key);
+ *   histogram_record(h, now_ns() - start - overhead);
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version, moved from the benchmarks.
+ */
+
+// ==========INTERFACE==========
+
+/**
+ * now_ns() - Read the monotonic clock.
+ *
+ * Returns: The current time in nanoseconds.
+ */
+long long now_ns(void);
+
+/**
+ * clock_overhead() - Estimate the cost of reading the clock.
+ *
+ * Returns: The median time in nanoseconds between two back-to-back
+ *          calls to now_ns().
+ */
+long long clock_overhead(void);
+
+#endif
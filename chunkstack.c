@@ -0,0 +1,480 @@
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "chunkstack.h"
+#include "arena.h"
+
+// Number of elements per chunk.
+#define CHUNK_SIZE 256
+
+/*
+ * Implementation of a generic stack for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The elements are stored in fixed-size chunks of element pointers.
+ * The chunks are linked from the top chunk downwards. A push or pop
+ * is normally a bounds check and an index update; memory is only
+ * allocated once per CHUNK_SIZE pushes. One empty chunk is kept as a
+ * spare, so a sequence of pushes and pops around a chunk boundary
+ * does not allocate and free a chunk every time.
+ *
+ * The interface and the behaviour of the kill function are the same
+ * as for the stack in stack.h: stack_pop() and stack_kill() call the
+ * kill function, if any, on the removed elements.
+ *
+ * A stack created with stack_empty_inline() (see chunkstack.h) stores
+ * copies of fixed-size elements in the chunks instead of pointers.
+ * A chunk is then CHUNK_SIZE slots of elem_size bytes, and stack_top()
+ * returns the address of the top slot.
+ *
+ * A stack created with stack_empty_arena() owns an arena. Both the
+ * chunks and the elements allocated by stack_alloc() come from the
+ * arena, and emptied chunks are kept on the spare list instead of
+ * being freed. stack_kill() and stack_reset() then only release the
+ * arena blocks, and never visit the elements.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: Added the inline element mode.
+ *   v1.2  2026-10-18: Added the arena mode and stack_reset().
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct chunk {
+    struct chunk *below; // The chunk below this one, or NULL
+    // CHUNK_SIZE slots, each an element pointer or an inline element.
+    // max_align_t makes every inline element suitably aligned.
+    max_align_t slots[];
+} chunk;
+
+struct stack {
+    chunk *top; // Chunk holding the top element, or NULL if empty
+    int top_count; // Number of elements in the top chunk
+    chunk *spare; // Unused chunks linked by below, or NULL
+    size_t elem_size; // Size of an inline element, or 0 for pointers
+    arena *arena; // Arena owning chunks and elements, or NULL
+    kill_function kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * slot() - Return the address of a slot in a chunk.
+ * @s: Stack that owns the chunk.
+ * @c: Chunk.
+ * @i: Slot index.
+ *
+ * Returns: The address of slot i.
+ */
+static void *slot(const stack *s, const chunk *c, int i)
+{
+    if (s->elem_size == 0) {
+        return (void **)c->slots + i;
+    }
+    return (unsigned char *)c->slots + (size_t)i * s->elem_size;
+}
+
+/**
+ * element() - Return an element of a chunk as seen by the user.
+ * @s: Stack that owns the chunk.
+ * @c: Chunk.
+ * @i: Slot index.
+ *
+ * Returns: The stored pointer, or the address of the inline element.
+ */
+static void *element(const stack *s, const chunk *c, int i)
+{
+    if (s->elem_size == 0) {
+        return ((void **)c->slots)[i];
+    }
+    return slot(s, c, i);
+}
+
+/**
+ * stack_empty() - Create an empty stack.
+ * @kill_func: A pointer to a function (or NULL) to be called to
+ *             de-allocate memory on remove/kill.
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty(kill_function kill_func)
+{
+    // Allocate the stack header. Use calloc as a defensive measure
+    // to ensure that all pointers are initialized to NULL.
+    stack *s = calloc(1, sizeof(*s));
+    s->kill_func = kill_func;
+
+    return s;
+}
+
+/**
+ * stack_empty_inline() - Create an empty stack of fixed-size elements.
+ * @elem_size: Size in bytes of each element. Must be greater than 0.
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty_inline(size_t elem_size)
+{
+    stack *s = stack_empty(NULL);
+    s->elem_size = elem_size;
+
+    return s;
+}
+
+/**
+ * stack_empty_arena() - Create an empty stack that owns an arena.
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty_arena(void)
+{
+    stack *s = stack_empty(NULL);
+    s->arena = arena_empty(0);
+
+    return s;
+}
+
+/**
+ * stack_alloc() - Allocate memory for an element from the arena of a stack.
+ * @s: Stack created with stack_empty_arena().
+ * @size: Number of bytes to allocate.
+ *
+ * Returns: A pointer to the allocated memory, or NULL if the stack
+ *          has no arena.
+ */
+void *stack_alloc(stack *s, size_t size)
+{
+    if (s->arena == NULL) {
+        fprintf(stderr, "stack_alloc: Warning: stack has no arena\n");
+        return NULL;
+    }
+    return arena_alloc(s->arena, size);
+}
+
+/**
+ * stack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool stack_is_empty(const stack *s)
+{
+    return s->top == NULL;
+}
+
+/**
+ * stack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value (pointer) to be put on the stack. For an inline stack,
+ *     elem_size bytes are copied from v.
+ *
+ * Returns: The modified stack.
+ */
+stack *stack_push(stack *s, void *v)
+{
+    if (s->top == NULL || s->top_count == CHUNK_SIZE) {
+        // The top chunk is full. Use a spare chunk or allocate one.
+        chunk *c = s->spare;
+        if (c != NULL) {
+            s->spare = c->below;
+        } else {
+            size_t slot_size = s->elem_size == 0 ? sizeof(void *) : s->elem_size;
+            size_t size = sizeof(*c) + CHUNK_SIZE * slot_size;
+            c = s->arena != NULL ? arena_alloc(s->arena, size) : malloc(size);
+        }
+        c->below = s->top;
+        s->top = c;
+        s->top_count = 0;
+    }
+    if (s->elem_size == 0) {
+        ((void **)s->top->slots)[s->top_count++] = v;
+    } else {
+        memcpy(slot(s, s->top, s->top_count++), v, s->elem_size);
+    }
+
+    return s;
+}
+
+/**
+ * stack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * NOTE: Undefined for an empty stack.
+ *
+ * Returns: The modified stack.
+ */
+stack *stack_pop(stack *s)
+{
+    if (stack_is_empty(s)) {
+        fprintf(stderr, "stack_pop: Warning: pop on empty stack\n");
+        return s;
+    }
+
+    void *v = element(s, s->top, --s->top_count);
+
+    if (s->top_count == 0) {
+        // The top chunk is empty. Keep it as a spare chunk. Arena
+        // chunks cannot be freed one by one, so they are all kept.
+        chunk *c = s->top;
+        s->top = c->below;
+        s->top_count = CHUNK_SIZE;
+        if (s->arena != NULL) {
+            c->below = s->spare;
+        } else {
+            free(s->spare);
+            c->below = NULL;
+        }
+        s->spare = c;
+    }
+    if (s->kill_func != NULL) {
+        s->kill_func(v);
+    }
+
+    return s;
+}
+
+/**
+ * stack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack. For an inline stack, the
+ *          address of the top element, valid until the next push, pop
+ *          or kill.
+ *          NOTE: The return value is undefined for an empty stack.
+ */
+void *stack_top(const stack *s)
+{
+    if (stack_is_empty(s)) {
+        fprintf(stderr, "stack_top: Warning: top on empty stack\n");
+        return NULL;
+    }
+    return element(s, s->top, s->top_count - 1);
+}
+
+/**
+ * clear() - Remove all elements and chunks from a stack.
+ * @s: Stack to clear.
+ *
+ * Calls the kill function, if any, on each element. Arena chunks are
+ * left to the caller, who resets or kills the arena.
+ *
+ * Returns: Nothing.
+ */
+static void clear(stack *s)
+{
+    if (s->arena == NULL) {
+        chunk *c = s->top;
+        int n = s->top_count;
+
+        while (c != NULL) {
+            if (s->kill_func != NULL) {
+                for (int i = n - 1; i >= 0; i--) {
+                    s->kill_func(element(s, c, i));
+                }
+            }
+            chunk *below = c->below;
+            free(c);
+            c = below;
+            // All chunks below the top chunk are full.
+            n = CHUNK_SIZE;
+        }
+        free(s->spare);
+    }
+    s->top = NULL;
+    s->top_count = 0;
+    s->spare = NULL;
+}
+
+/**
+ * stack_reset() - Remove all elements from a stack.
+ * @s: Stack to reset.
+ *
+ * For an arena stack, all memory from stack_alloc() is released and
+ * the arena blocks are kept for reuse. Otherwise the kill function,
+ * if any, is called for each element.
+ *
+ * Returns: Nothing.
+ */
+void stack_reset(stack *s)
+{
+    clear(s);
+    if (s->arena != NULL) {
+        arena_reset(s->arena);
+    }
+}
+
+/**
+ * stack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Return all dynamic memory used by the stack and its elements. If a
+ * kill_func was registered at stack creation, also calls it for each
+ * element to kill any user-allocated memory occupied by the element values.
+ * For an arena stack, the arena is killed instead.
+ *
+ * Returns: Nothing.
+ */
+void stack_kill(stack *s)
+{
+    clear(s);
+    if (s->arena != NULL) {
+        arena_kill(s->arena);
+    }
+    free(s);
+}
+
+/**
+ * stack_print() - Iterate over the stack elements and print their values.
+ * @s: Stack to inspect.
+ * @print_func: Function called for each element.
+ *
+ * Iterates over the stack from the top and calls print_func with
+ * each element.
+ *
+ * Returns: Nothing.
+ */
+void stack_print(const stack *s, inspect_callback print_func)
+{
+    printf("{ ");
+    chunk *c = s->top;
+    int n = s->top_count;
+
+    while (c != NULL) {
+        for (int i = n - 1; i >= 0; i--) {
+            print_func(element(s, c, i));
+            if (i > 0 || c->below != NULL) {
+                printf(", ");
+            }
+        }
+        c = c->below;
+        n = CHUNK_SIZE;
+    }
+    printf(" }\n");
+}
+
+// ===========INTERNAL FUNCTIONS USED BY stack_print_internal ============
+
+// The functions below output code in the dot language, used by
+// GraphViz. For documention of the dot language, see graphviz.org.
+
+/**
+ * iprintf(...) - Indent and print.
+ * @n: Indentation level
+ * @...: printf arguments
+ *
+ * Print n tab characters and calls printf.
+ *
+ * Returns: Nothing.
+ */
+static void iprintf(int n, const char *fmt, ...)
+{
+    // Indent...
+    for (int i = 0; i < n; i++) {
+        printf("\t");
+    }
+    // ...and call printf
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+// Internal function to print a description string with the most
+// common control characters escaped.
+static void print_escaped(const char *s)
+{
+    for (; *s != '\0'; s++) {
+        switch (*s) {
+        case '\n': printf("\\n");  break;
+        case '\t': printf("\\t");  break;
+        case '\\': printf("\\\\"); break;
+        case '\"': printf("\\\""); break;
+        default:   putchar(*s);    break;
+        }
+    }
+}
+
+/**
+ * stack_print_internal() - Print the internal structure of the stack in dot format.
+ * @s: Stack to inspect.
+ * @print_func: Function called for each element value.
+ * @desc: String with a description/state of the stack, or NULL for no description.
+ * @indent_level: Indentation level, 0 for outermost
+ *
+ * Iterates over the stack and outputs dot code that shows the
+ * internal structure of the stack: the head, the chunks and the
+ * element values.
+ *
+ * Returns: Nothing.
+ */
+void stack_print_internal(const stack *s, inspect_callback print_func, const char *desc,
+                          int indent_level)
+{
+    static int graph_number = 0;
+    graph_number++;
+    int il = indent_level;
+
+    if (indent_level == 0) {
+        // If this is the outermost datatype, start a graph and set up defaults
+        printf("digraph STACK_%d {\n", graph_number);
+        il++;
+        iprintf(il, "node [shape=rectangle fontname=\"Courier New\"]\n");
+        iprintf(il, "ranksep=0.01\n");
+    }
+
+    if (desc != NULL) {
+        iprintf(il, "cluster_stack_%d_description [label=\"", graph_number);
+        print_escaped(desc);
+        printf("\"]\n");
+    }
+
+    // Output the head node and the edge to the top chunk.
+    iprintf(il, "m%04lx [shape=record label=\"<t>top\\n%04lx|top_count\\n%d|spare\\n%04lx"
+            "|elem_size\\n%zu|arena\\n%04lx|kill\\n%04lx\"]\n", PTR2ADDR(s), PTR2ADDR(s->top),
+            s->top_count, PTR2ADDR(s->spare), s->elem_size, PTR2ADDR(s->arena),
+            PTR2ADDR(s->kill_func));
+    if (s->top != NULL) {
+        iprintf(il, "m%04lx:t -> m%04lx\n", PTR2ADDR(s), PTR2ADDR(s->top));
+    }
+
+    // Output one record node per chunk with the used slots, top first.
+    // Inline elements are shown by the address of their slot.
+    chunk *c = s->top;
+    int n = s->top_count;
+    while (c != NULL) {
+        iprintf(il, "m%04lx [shape=record label=\"<b>below\\n%04lx", PTR2ADDR(c),
+                PTR2ADDR(c->below));
+        for (int i = n - 1; i >= 0; i--) {
+            printf("|<e%d>[%d]\\n%04lx", i, i, PTR2ADDR(element(s, c, i)));
+        }
+        printf("\"]\n");
+        if (c->below != NULL) {
+            iprintf(il, "m%04lx:b -> m%04lx\n", PTR2ADDR(c), PTR2ADDR(c->below));
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            void *v = element(s, c, i);
+            if (v == NULL) {
+                continue;
+            }
+            iprintf(il, "m%04lx [label=\"", PTR2ADDR(v));
+            if (print_func != NULL) {
+                print_func(v);
+            }
+            printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(v));
+            iprintf(il, "m%04lx:e%d -> m%04lx [color=red%s]\n", PTR2ADDR(c), i,
+                    PTR2ADDR(v), s->kill_func ? "" : " style=dashed");
+        }
+        c = c->below;
+        n = CHUNK_SIZE;
+    }
+
+    if (indent_level == 0) {
+        // Termination of graph
+        printf("}\n");
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef __CHUNKSTACK_H
+#define __CHUNKSTACK_H
+
+#include <stddef.h>
+
+#include <stack.h>
+
+/*
+ * Extensions to the generic stack in stack.h for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * The functions declared here are only provided by chunkstack.c. All
+ * functions in stack.h work on the stacks created here.
+ *
+ * An inline stack stores copies of fixed-size elements instead of
+ * pointers. stack_push() copies elem_size bytes from the given
+ * pointer into the stack, and stack_top() returns a pointer to the
+ * copy. The pointer is valid until the next push, pop or kill on the
+ * stack. The stack owns the copies, so no kill function is used.
+ *
+ * Example:
+ *   stack *s = stack_empty_inline(sizeof(int));
+ *   int v = 5;
+ *   s = stack_push(s, &v);
+ *   int top = *(int *)stack_top(s);
+ *
+ * An arena stack owns a memory arena (see arena.h). Elements are
+ * allocated with stack_alloc() and pushed as usual. They are never
+ * freed one by one: stack_pop() leaves the memory in the arena, and
+ * stack_reset() and stack_kill() release all of it at once, in time
+ * proportional to the number of arena blocks.
+ *
+ * Example:
+ *   stack *s = stack_empty_arena();
+ *   int *v = stack_alloc(s, sizeof(int));
+ *   *v = 5;
+ *   s = stack_push(s, v);
+ *   stack_kill(s); // Also releases v
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: Added the arena stack and stack_reset().
+ */
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * stack_empty_inline() - Create an empty stack of fixed-size elements.
+ * @elem_size: Size in bytes of each element. Must be greater than 0.
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty_inline(size_t elem_size);
+
+/**
+ * stack_empty_arena() - Create an empty stack that owns an arena.
+ *
+ * The stack has no kill function. Its elements should be allocated
+ * with stack_alloc().
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty_arena(void);
+
+/**
+ * stack_alloc() - Allocate memory for an element from the arena of a stack.
+ * @s: Stack created with stack_empty_arena().
+ * @size: Number of bytes to allocate.
+ *
+ * Returns: A pointer to memory suitably aligned for any type, valid
+ *          until the stack is reset or killed. NULL if the stack has
+ *          no arena.
+ */
+void *stack_alloc(stack *s, size_t size);
+
+/**
+ * stack_reset() - Remove all elements from a stack.
+ * @s: Stack to reset.
+ *
+ * Leaves the stack empty and ready for reuse. For an arena stack, all
+ * memory from stack_alloc() is released, but the arena keeps its
+ * blocks. For other stacks, the kill function, if any, is called for
+ * each element.
+ *
+ * Returns: Nothing.
+ */
+void stack_reset(stack *s);
+
+#endif
@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "chunkstack.h"
+
+/**
+ * chunkstack_test.c - Tests for the extensions in chunkstack.h.
+ *
+ * The pointer mode is covered by stack_test.c. The inline tests create
+ * stacks with stack_empty_inline() and push values directly from
+ * local variables, without allocating memory for each element. The
+ * arena tests allocate elements with stack_alloc() and rely on
+ * stack_reset() and stack_kill() to release them; run under valgrind
+ * or AddressSanitizer to detect leaks. Each test terminates the
+ * program with an error message if it fails.
+ *
+ * Compile with:
+ *   gcc -std=c11 -I<include> chunkstack_test.c chunkstack.c arena.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Added tests for the arena stack and stack_reset().
+ */
+
+// A multi-field element, to check that whole elements are copied.
+typedef struct point {
+    double x;
+    double y;
+    char tag;
+} point;
+
+/**
+ * inline_push_top_test() - Test that push copies the element.
+ *
+ * Pushes a local variable, changes the variable and checks that the
+ * top of the stack still holds the pushed value.
+ */
+void inline_push_top_test(void)
+{
+    fprintf(stderr, "Starting inline_push_top_test()...");
+
+    stack *s = stack_empty_inline(sizeof(int));
+    int v = 10;
+
+    s = stack_push(s, &v);
+    v = 20;
+
+    int *top = stack_top(s);
+    if (top == &v || *top != 10) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: expected top 10, got %d\n", *top);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: stack_push copied the element.\n");
+    stack_kill(s);
+}
+
+/**
+ * inline_order_test() - Test LIFO order over several chunks.
+ *
+ * Pushes enough struct elements to fill several chunks, then pops
+ * them and checks each top along the way.
+ */
+void inline_order_test(void)
+{
+    fprintf(stderr, "Starting inline_order_test()...");
+
+    int n = 1000;
+    stack *s = stack_empty_inline(sizeof(point));
+
+    for (int i = 0; i < n; i++) {
+        point p = { i, -i, (char)('a' + i % 26) };
+        s = stack_push(s, &p);
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        const point *p = stack_top(s);
+        if (p->x != i || p->y != -i || p->tag != 'a' + i % 26) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: expected element %d, got (%g, %g, %c)\n", i, p->x, p->y,
+                    p->tag);
+            exit(EXIT_FAILURE);
+        }
+        s = stack_pop(s);
+    }
+    if (!stack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: stack not empty after popping all elements.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: %d elements were popped in LIFO order.\n", n);
+    stack_kill(s);
+}
+
+/**
+ * inline_kill_test() - Test killing a non-empty inline stack.
+ *
+ * Run under valgrind or AddressSanitizer to detect leaks.
+ */
+void inline_kill_test(void)
+{
+    fprintf(stderr, "Starting inline_kill_test()...");
+
+    stack *s = stack_empty_inline(sizeof(long));
+    for (long i = 0; i < 600; i++) {
+        s = stack_push(s, &i);
+    }
+    stack_kill(s);
+
+    fprintf(stderr, "Test succeeded: stack_kill returned.\n");
+}
+
+/**
+ * arena_push_pop_test() - Test an arena stack with allocated elements.
+ *
+ * Pushes elements allocated with stack_alloc() over several chunks,
+ * checks them in LIFO order, then pushes again to reuse the chunks
+ * and kills the stack without popping.
+ */
+void arena_push_pop_test(void)
+{
+    fprintf(stderr, "Starting arena_push_pop_test()...");
+
+    int n = 1000;
+    stack *s = stack_empty_arena();
+
+    for (int i = 0; i < n; i++) {
+        int *v = stack_alloc(s, sizeof(int));
+        *v = i;
+        s = stack_push(s, v);
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        int *v = stack_top(s);
+        if (*v != i) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: expected top %d, got %d\n", i, *v);
+            exit(EXIT_FAILURE);
+        }
+        s = stack_pop(s);
+    }
+    for (int i = 0; i < n; i++) {
+        point *p = stack_alloc(s, sizeof(point));
+        *p = (point) { i, i, 'p' };
+        s = stack_push(s, p);
+    }
+    if (((const point *)stack_top(s))->x != n - 1) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: wrong top after reusing the chunks.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: %d arena elements were popped in LIFO order.\n", n);
+    stack_kill(s);
+}
+
+/**
+ * reset_test() - Test stack_reset on arena and ordinary stacks.
+ *
+ * Fills and resets each stack a few times and checks that it is
+ * empty and usable after each reset.
+ */
+void reset_test(void)
+{
+    fprintf(stderr, "Starting reset_test()...");
+
+    stack *arena_stack = stack_empty_arena();
+    stack *free_stack = stack_empty(free);
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 700; i++) {
+            int *v = stack_alloc(arena_stack, sizeof(int));
+            *v = round;
+            arena_stack = stack_push(arena_stack, v);
+
+            v = malloc(sizeof(int));
+            *v = round;
+            free_stack = stack_push(free_stack, v);
+        }
+        if (*(int *)stack_top(arena_stack) != round || *(int *)stack_top(free_stack) != round) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: expected top %d after reset.\n", round);
+            exit(EXIT_FAILURE);
+        }
+        stack_reset(arena_stack);
+        stack_reset(free_stack);
+        if (!stack_is_empty(arena_stack) || !stack_is_empty(free_stack)) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: stack not empty after stack_reset.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    fprintf(stderr, "Test succeeded: stack_reset emptied the stacks.\n");
+    stack_kill(arena_stack);
+    stack_kill(free_stack);
+}
+
+int main(void)
+{
+    inline_push_top_test();     // Test that stack_push copies elements
+    inline_order_test();        // Test push, top and pop across chunks
+    inline_kill_test();         // Test stack_kill
+    arena_push_pop_test();      // Test stack_alloc with push and pop
+    reset_test();               // Test stack_reset
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
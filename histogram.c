@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "histogram.h"
+
+/*
+ * Latency histogram, see histogram.h.
+ *
+ * The buckets are log-linear. Values below 2 * SUB_BUCKETS have one
+ * bucket each. A larger value v with highest set bit b is shifted
+ * right by b - SUB_BITS, which leaves a number in [SUB_BUCKETS,
+ * 2 * SUB_BUCKETS), and each shift has its own row of SUB_BUCKETS
+ * buckets. Bucket i thus covers the values [lowest(i), lowest(i + 1)).
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// Number of buckets per power of two, as a power of two. 7 gives a
+// relative error of at most 1/128.
+#define SUB_BITS 7
+#define SUB_BUCKETS (1 << SUB_BITS)
+
+// Values of 2^MAX_BITS and above go into the last bucket.
+#define MAX_BITS 40
+
+#define NUM_BUCKETS ((MAX_BITS - SUB_BITS + 1) * SUB_BUCKETS)
+
+// ===========INTERNAL DATA TYPES ============
+
+struct histogram {
+    long long count;
+    long long sum;
+    long long max;
+    long long buckets[NUM_BUCKETS];
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * bucket_of() - Return the bucket of a value.
+ * @v: Non-negative value.
+ *
+ * Returns: The bucket index.
+ */
+static int bucket_of(long long v)
+{
+    if (v < 2 * SUB_BUCKETS) {
+        return (int)v;
+    }
+    if (v >= 1LL << MAX_BITS) {
+        return NUM_BUCKETS - 1;
+    }
+    int shift = 63 - __builtin_clzll((unsigned long long)v) - SUB_BITS;
+    return (shift + 1) * SUB_BUCKETS + (int)(v >> shift) - SUB_BUCKETS;
+}
+
+/**
+ * lowest_of() - Return the lowest value of a bucket.
+ * @i: Bucket index.
+ *
+ * Returns: The lowest value that falls into bucket i.
+ */
+static long long lowest_of(int i)
+{
+    if (i < 2 * SUB_BUCKETS) {
+        return i;
+    }
+    int shift = i / SUB_BUCKETS - 1;
+    return (long long)(i % SUB_BUCKETS + SUB_BUCKETS) << shift;
+}
+
+// ==========INTERFACE==========
+
+/**
+ * histogram_empty() - Create an empty histogram.
+ *
+ * Returns: A pointer to the new histogram.
+ */
+histogram *histogram_empty(void)
+{
+    return calloc(1, sizeof(histogram));
+}
+
+/**
+ * histogram_record() - Record a value.
+ * @h: Histogram to update.
+ * @value: Value to record. Negative values are recorded as 0.
+ *
+ * Returns: Nothing.
+ */
+void histogram_record(histogram *h, long long value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+    h->buckets[bucket_of(value)]++;
+    h->count++;
+    h->sum += value;
+    if (value > h->max) {
+        h->max = value;
+    }
+}
+
+/**
+ * histogram_count() - Return the number of recorded values.
+ * @h: Histogram to inspect.
+ *
+ * Returns: The number of values.
+ */
+long long histogram_count(const histogram *h)
+{
+    return h->count;
+}
+
+/**
+ * histogram_mean() - Return the mean of the recorded values.
+ * @h: Histogram to inspect.
+ *
+ * Returns: The exact mean, or 0 if the histogram is empty.
+ */
+double histogram_mean(const histogram *h)
+{
+    return h->count > 0 ? (double)h->sum / h->count : 0.0;
+}
+
+/**
+ * histogram_max() - Return the largest recorded value.
+ * @h: Histogram to inspect.
+ *
+ * Returns: The exact maximum, or 0 if the histogram is empty.
+ */
+long long histogram_max(const histogram *h)
+{
+    return h->max;
+}
+
+/**
+ * histogram_percentile() - Return a percentile of the recorded values.
+ * @h: Histogram to inspect.
+ * @p: Percentile, from 0 to 100.
+ *
+ * Returns: The largest value in the bucket that holds the percentile,
+ * at most the maximum, or 0 if the histogram is empty.
+ */
+long long histogram_percentile(const histogram *h, double p)
+{
+    if (h->count == 0) {
+        return 0;
+    }
+    // The rank of the percentile, from 1 to count.
+    long long rank = (long long)(p / 100.0 * h->count + 0.5);
+    if (rank < 1) {
+        rank = 1;
+    } else if (rank > h->count) {
+        rank = h->count;
+    }
+
+    long long seen = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            long long highest = i + 1 < NUM_BUCKETS ? lowest_of(i + 1) - 1 : h->max;
+            return highest < h->max ? highest : h->max;
+        }
+    }
+    return h->max;
+}
+
+/**
+ * histogram_format() - Format the standard percentiles.
+ * @h: Histogram to inspect.
+ * @buf: Buffer for the text.
+ * @size: Size of the buffer.
+ *
+ * Returns: buf.
+ */
+char *histogram_format(const histogram *h, char *buf, size_t size)
+{
+    snprintf(buf, size, "p50=%lld p90=%lld p99=%lld p999=%lld max=%lld",
+             histogram_percentile(h, 50), histogram_percentile(h, 90),
+             histogram_percentile(h, 99), histogram_percentile(h, 99.9), h->max);
+    return buf;
+}
+
+/**
+ * histogram_merge() - Add the values of one histogram to another.
+ * @dst: Histogram to update.
+ * @src: Histogram to add.
+ *
+ * Returns: Nothing.
+ */
+void histogram_merge(histogram *dst, const histogram *src)
+{
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        dst->buckets[i] += src->buckets[i];
+    }
+    dst->count += src->count;
+    dst->sum += src->sum;
+    if (src->max > dst->max) {
+        dst->max = src->max;
+    }
+}
+
+/**
+ * histogram_reset() - Remove all recorded values.
+ * @h: Histogram to reset.
+ *
+ * Returns: Nothing.
+ */
+void histogram_reset(histogram *h)
+{
+    memset(h, 0, sizeof(*h));
+}
+
+/**
+ * histogram_kill() - Destroy a histogram.
+ * @h: Histogram to destroy.
+ *
+ * Returns: Nothing.
+ */
+void histogram_kill(histogram *h)
+{
+    free(h);
+}
@@ -0,0 +1,122 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stddef.h>
+
+/*
+ * Latency histogram with bounded relative error, in the style of
+ * HdrHistogram.
+ *
+ * Values are non-negative integers, typically nanoseconds. Values
+ * below 256 are counted exactly. Larger values fall into buckets
+ * whose width is at most 1/128 of the value, so a percentile is
+ * within 0.8% of the exact one. Values of 2^40 (about 18 minutes in
+ * ns) and above share the last bucket. Recording a value is a few
+ * instructions and never allocates, so the histogram can be used
+ * around single table and stack operations. The count, the sum and
+ * the maximum are exact.
+ *
+ * A typical use with now_ns() and clock_overhead() from bench_clock.h:
+ *
+ *   long long start = now_ns();
+ *   table_lookup(t, key);
+ *   histogram_record(h, now_ns() - start - overhead);
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+typedef struct histogram histogram;
+
+// ==========INTERFACE==========
+
+/**
+ * histogram_empty() - Create an empty histogram.
+ *
+ * Returns: A pointer to the new histogram.
+ */
+histogram *histogram_empty(void);
+
+/**
+ * histogram_record() - Record a value.
+ * @h: Histogram to update.
+ * @value: Value to record. Negative values are recorded as 0.
+ *
+ * Returns: Nothing.
+ */
+void histogram_record(histogram *h, long long value);
+
+/**
+ * histogram_count() - Return the number of recorded values.
+ * @h: Histogram to inspect.
+ *
+ * Returns: The number of values.
+ */
+long long histogram_count(const histogram *h);
+
+/**
+ * histogram_mean() - Return the mean of the recorded values.
+ * @h: Histogram to inspect.
+ *
+ * Returns: The exact mean, or 0 if the histogram is empty.
+ */
+double histogram_mean(const histogram *h);
+
+/**
+ * histogram_max() - Return the largest recorded value.
+ * @h: Histogram to inspect.
+ *
+ * Returns: The exact maximum, or 0 if the histogram is empty.
+ */
+long long histogram_max(const histogram *h);
+
+/**
+ * histogram_percentile() - Return a percentile of the recorded values.
+ * @h: Histogram to inspect.
+ * @p: Percentile, from 0 to 100.
+ *
+ * Returns: The largest value in the bucket that holds the percentile,
+ * at most the maximum, or 0 if the histogram is empty.
+ */
+long long histogram_percentile(const histogram *h, double p);
+
+/**
+ * histogram_format() - Format the standard percentiles.
+ * @h: Histogram to inspect.
+ * @buf: Buffer for the text.
+ * @size: Size of the buffer.
+ *
+ * Writes "p50=... p90=... p99=... p999=... max=...".
+ *
+ * Returns: buf.
+ */
+char *histogram_format(const histogram *h, char *buf, size_t size);
+
+/**
+ * histogram_merge() - Add the values of one histogram to another.
+ * @dst: Histogram to update.
+ * @src: Histogram to add.
+ *
+ * Returns: Nothing.
+ */
+void histogram_merge(histogram *dst, const histogram *src);
+
+/**
+ * histogram_reset() - Remove all recorded values.
+ * @h: Histogram to reset.
+ *
+ * Returns: Nothing.
+ */
+void histogram_reset(histogram *h);
+
+/**
+ * histogram_kill() - Destroy a histogram.
+ * @h: Histogram to destroy.
+ *
+ * Returns: Nothing.
+ */
+void histogram_kill(histogram *h);
+
+#endif
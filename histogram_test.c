@@ -0,0 +1,180 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "histogram.h"
+
+/**
+ * histogram_test.c - Tests for the latency histogram.
+ *
+ * This file contains tests for the functions declared in histogram.h.
+ * Each test terminates the program with an error message if it fails.
+ *
+ * Compile with: gcc -I<include> histogram_test.c histogram.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ */
+
+/**
+ * empty_test() - Test an empty histogram.
+ *
+ * All statistics of an empty histogram are 0.
+ */
+void empty_test(void)
+{
+    fprintf(stderr, "Starting empty_test()...");
+
+    histogram *h = histogram_empty();
+
+    if (histogram_count(h) != 0 || histogram_max(h) != 0 || histogram_mean(h) != 0.0
+        || histogram_percentile(h, 50) != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: an empty histogram has nonzero statistics.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: an empty histogram has zero statistics.\n");
+    histogram_kill(h);
+}
+
+/**
+ * exact_test() - Test that small values are counted exactly.
+ *
+ * Records 1..100 and checks the percentiles, the mean and the maximum.
+ */
+void exact_test(void)
+{
+    fprintf(stderr, "Starting exact_test()...");
+
+    histogram *h = histogram_empty();
+    for (int v = 1; v <= 100; v++) {
+        histogram_record(h, v);
+    }
+
+    if (histogram_percentile(h, 50) != 50 || histogram_percentile(h, 99) != 99
+        || histogram_percentile(h, 100) != 100 || histogram_percentile(h, 0) != 1
+        || histogram_max(h) != 100 || histogram_mean(h) != 50.5) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: wrong statistics of 1..100.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: small values were counted exactly.\n");
+    histogram_kill(h);
+}
+
+/**
+ * error_test() - Test the relative error of large values.
+ *
+ * Records 1..10^6 and checks that every percentile from 1 to 100 is
+ * at least the exact one and at most 1/128 above it.
+ */
+void error_test(void)
+{
+    fprintf(stderr, "Starting error_test()...");
+
+    histogram *h = histogram_empty();
+    long long n = 1000000;
+    for (long long v = 1; v <= n; v++) {
+        histogram_record(h, v);
+    }
+
+    for (int p = 1; p <= 100; p++) {
+        long long exact = n * p / 100;
+        long long got = histogram_percentile(h, p);
+        if (got < exact || got > exact + exact / 128 + 1) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: percentile %d is %lld, expected %lld.\n", p, got, exact);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (histogram_max(h) != n) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: the maximum is %lld, expected %lld.\n", histogram_max(h), n);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: all percentiles were within 1/128 of the exact ones.\n");
+    histogram_kill(h);
+}
+
+/**
+ * tail_test() - Test that rare slow values show in the tail.
+ *
+ * Records 9980 fast and 20 slow values. p99 must be fast and p999
+ * slow, and out of range or negative values must be clamped.
+ */
+void tail_test(void)
+{
+    fprintf(stderr, "Starting tail_test()...");
+
+    histogram *h = histogram_empty();
+    for (int i = 0; i < 9980; i++) {
+        histogram_record(h, 20);
+    }
+    for (int i = 0; i < 20; i++) {
+        histogram_record(h, 1000000);
+    }
+
+    long long p999 = histogram_percentile(h, 99.9);
+    if (histogram_percentile(h, 99) != 20 || p999 < 1000000 || p999 > 1000000 + 1000000 / 128) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: the slow values were not in the tail.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    histogram_record(h, -5);
+    histogram_record(h, 1LL << 50);
+    if (histogram_percentile(h, 0) != 0 || histogram_percentile(h, 100) != 1LL << 50) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: negative or huge values were not clamped.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: the slow values were in the tail.\n");
+    histogram_kill(h);
+}
+
+/**
+ * merge_test() - Test histogram_merge and histogram_reset.
+ */
+void merge_test(void)
+{
+    fprintf(stderr, "Starting merge_test()...");
+
+    histogram *a = histogram_empty();
+    histogram *b = histogram_empty();
+    for (int v = 1; v <= 50; v++) {
+        histogram_record(a, v);
+        histogram_record(b, v + 50);
+    }
+    histogram_merge(a, b);
+
+    if (histogram_count(a) != 100 || histogram_percentile(a, 50) != 50
+        || histogram_max(a) != 100) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: the merged histogram is wrong.\n");
+        exit(EXIT_FAILURE);
+    }
+    histogram_reset(a);
+    if (histogram_count(a) != 0 || histogram_max(a) != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: histogram_reset did not empty the histogram.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: histograms were merged and reset.\n");
+    histogram_kill(a);
+    histogram_kill(b);
+}
+
+int main(void)
+{
+    empty_test();       // Test an empty histogram
+    exact_test();       // Test small values
+    error_test();       // Test the relative error
+    tail_test();        // Test tail percentiles and clamping
+    merge_test();       // Test merge and reset
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
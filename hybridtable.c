@@ -0,0 +1,900 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h> // For isspace()
+#include <stdarg.h>
+
+#include <table.h>
+
+#include "table_ext.h"
+
+// Largest number of entries kept in the small array. The table turns
+// into a hash table when an insert would exceed it.
+#define SMALL_MAX 16
+
+// The hash table turns back into a small array when a remove leaves
+// fewer than DEMOTE_SIZE entries. The gap to SMALL_MAX keeps a table
+// that grows and shrinks around one size from converting on every
+// operation.
+#define DEMOTE_SIZE 8
+
+// Smallest number of slots of the hash table. Must be a power of two.
+#define MIN_SLOTS 64
+
+// Marks a used slot. It is or:ed into the stored hash value, so an
+// unused slot has hash 0.
+#define USED_BIT (1UL << (8 * sizeof(unsigned long) - 1))
+
+/*
+ * Implementation of a generic table for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The table has two layouts behind the table.h interface:
+ *  - A small array of at most SMALL_MAX key/value pairs, searched
+ *    linearly like arraytable.c. For a few entries this beats hashing,
+ *    since a search is a handful of compares in one or two cache lines
+ *    and no hash value is computed.
+ *  - An open addressing hash table with linear probing, used when the
+ *    table grows beyond SMALL_MAX entries. Each slot holds the key,
+ *    the value and the hash value of the key, so a probe only calls
+ *    the compare function when the hash values match. The table
+ *    doubles when it is 3/4 full and halves when it is less than 1/8
+ *    full. Removal shifts the following entries of the probe sequence
+ *    back, so no tombstones are needed.
+ * The table goes back to the small array when fewer than DEMOTE_SIZE
+ * entries remain. Every conversion and resize rehashes all entries at
+ * once, which is O(n) but amortized O(1) per operation; hashtable.c
+ * bounds the cost of each operation instead.
+ *
+ * Only tables created with table_empty_hashed() from table_ext.h can
+ * turn into a hash table. A table created with table_empty() stays a
+ * growing array, like arraytable.c.
+ *
+ * Inserting a key that is already in the table replaces its key and
+ * value, so the table holds no duplicates.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct slot {
+    void *key;
+    void *value;
+    unsigned long hash; // Hash value of the key or:ed with USED_BIT, 0 if unused
+} slot;
+
+struct table {
+    slot *slots; // The small array, or the hash table slots
+    int n_slots; // Number of slots, a power of two in the hash layout
+    int size; // Number of entries
+    bool hashed; // True in the hash layout
+    int choose_hint; // Slot where table_choose_key() starts to search
+    compare_function *key_cmp_func;
+    hash_function *key_hash_func;
+    kill_function key_kill_func;
+    kill_function value_kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+// Internal function to compute the stored hash value of a key.
+static unsigned long slot_hash(const table *t, const void *key)
+{
+    return t->key_hash_func(key) | USED_BIT;
+}
+
+// Internal function to return the index mask of the hash layout.
+static int slot_mask(const table *t)
+{
+    return t->n_slots - 1;
+}
+
+/**
+ * find_slot() - Find the slot of a key.
+ * @t: Table to inspect.
+ * @key: Key to search for.
+ * @hash: The stored hash value of the key, if the layout is hashed.
+ *
+ * Returns: The index of the slot holding the key, or -1.
+ */
+static int find_slot(const table *t, const void *key, unsigned long hash)
+{
+    if (!t->hashed) {
+        for (int i = 0; i < t->size; i++) {
+            if (t->key_cmp_func(t->slots[i].key, key) == 0) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    int mask = slot_mask(t);
+    for (int i = hash & mask; t->slots[i].hash != 0; i = (i + 1) & mask) {
+        if (t->slots[i].hash == hash && t->key_cmp_func(t->slots[i].key, key) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Internal function to store an entry in the first free slot of its
+// probe sequence. The key must not be in the slots.
+static void place(slot *slots, int mask, void *key, void *value, unsigned long hash)
+{
+    int i = hash & mask;
+
+    while (slots[i].hash != 0) {
+        i = (i + 1) & mask;
+    }
+    slots[i].key = key;
+    slots[i].value = value;
+    slots[i].hash = hash;
+}
+
+/**
+ * rehash() - Move all entries to a hash layout with a given size.
+ * @t: Table to manipulate.
+ * @n_slots: Number of slots, a power of two larger than the size.
+ *
+ * Works from both layouts. Entries of the small array are hashed
+ * here.
+ *
+ * Returns: Nothing.
+ */
+static void rehash(table *t, int n_slots)
+{
+    slot *slots = calloc(n_slots, sizeof(slot));
+
+    for (int i = 0; i < (t->hashed ? t->n_slots : t->size); i++) {
+        slot *s = &t->slots[i];
+        if (t->hashed && s->hash == 0) {
+            continue;
+        }
+        unsigned long hash = t->hashed ? s->hash : slot_hash(t, s->key);
+        place(slots, n_slots - 1, s->key, s->value, hash);
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->n_slots = n_slots;
+    t->hashed = true;
+    t->choose_hint = 0;
+}
+
+// Internal function to move all entries of the hash layout to a small
+// array.
+static void demote(table *t)
+{
+    slot *slots = malloc(SMALL_MAX * sizeof(slot));
+    int n = 0;
+
+    for (int i = 0; i < t->n_slots; i++) {
+        if (t->slots[i].hash != 0) {
+            slots[n++] = t->slots[i];
+        }
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->n_slots = SMALL_MAX;
+    t->hashed = false;
+}
+
+/**
+ * add_entry() - Add an entry for a key that is not in the table.
+ * @t: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ * @hash: The stored hash value of the key, if the layout is hashed.
+ *
+ * Converts or resizes the layout first if needed.
+ *
+ * Returns: Nothing.
+ */
+static void add_entry(table *t, void *key, void *value, unsigned long hash)
+{
+    if (!t->hashed) {
+        if (t->size == SMALL_MAX && t->key_hash_func != NULL) {
+            rehash(t, MIN_SLOTS);
+            hash = slot_hash(t, key);
+        } else {
+            if (t->size == t->n_slots) {
+                // Without a hash function, the array grows like arraytable.c.
+                t->n_slots *= 2;
+                t->slots = realloc(t->slots, t->n_slots * sizeof(slot));
+            }
+            t->slots[t->size].key = key;
+            t->slots[t->size].value = value;
+            t->size++;
+            return;
+        }
+    } else if (4 * (t->size + 1) > 3 * t->n_slots) {
+        rehash(t, 2 * t->n_slots);
+    }
+    place(t->slots, slot_mask(t), key, value, hash);
+    t->size++;
+}
+
+/**
+ * remove_slot() - Remove the entry in a slot.
+ * @t: Table to manipulate.
+ * @i: Index of the slot.
+ *
+ * In the small array, the last entry is moved into the slot. In the
+ * hash layout, the following entries of the probe sequence that may
+ * move are shifted back into the hole. The layout is then shrunk or
+ * converted back if the table has become small.
+ *
+ * Returns: Nothing.
+ */
+static void remove_slot(table *t, int i)
+{
+    t->size--;
+    if (!t->hashed) {
+        t->slots[i] = t->slots[t->size];
+        return;
+    }
+
+    int mask = slot_mask(t);
+    int hole = i;
+    for (int j = (i + 1) & mask; t->slots[j].hash != 0; j = (j + 1) & mask) {
+        // The entry at j may fill the hole if its home slot is not in
+        // the cyclic range (hole, j].
+        int home = t->slots[j].hash & mask;
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            t->slots[hole] = t->slots[j];
+            hole = j;
+        }
+    }
+    t->slots[hole].hash = 0;
+
+    if (t->size < DEMOTE_SIZE) {
+        demote(t);
+    } else if (t->n_slots > MIN_SLOTS && 8 * t->size < t->n_slots) {
+        rehash(t, t->n_slots / 2);
+    }
+}
+
+// Internal function to replace the key and value of a slot, killing
+// the old ones.
+static void replace_slot(table *t, slot *s, void *key, void *value)
+{
+    if (t->key_kill_func != NULL && s->key != key) {
+        t->key_kill_func(s->key);
+    }
+    if (t->value_kill_func != NULL && s->value != value) {
+        t->value_kill_func(s->value);
+    }
+    s->key = key;
+    s->value = value;
+}
+
+// ==========INTERFACE==========
+
+/**
+ * table_empty() - Create an empty table.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * The table never turns into a hash table. Use table_empty_hashed().
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty(compare_function *key_cmp_func,
+                   kill_function key_kill_func,
+                   kill_function value_kill_func)
+{
+    return table_empty_hashed(key_cmp_func, NULL, key_kill_func, value_kill_func);
+}
+
+/**
+ * table_empty_hashed() - Create an empty table that hashes its keys.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function to be used to hash keys, or
+ *                 NULL to always use the array layout.
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_hashed(compare_function *key_cmp_func,
+                          hash_function *key_hash_func,
+                          kill_function key_kill_func,
+                          kill_function value_kill_func)
+{
+    table *t = calloc(1, sizeof(table));
+
+    t->slots = malloc(SMALL_MAX * sizeof(slot));
+    t->n_slots = SMALL_MAX;
+    t->size = 0;
+    t->hashed = false;
+
+    // Store the key compare and hash functions and key/value kill functions.
+    t->key_cmp_func = key_cmp_func;
+    t->key_hash_func = key_hash_func;
+    t->key_kill_func = key_kill_func;
+    t->value_kill_func = value_kill_func;
+
+    return t;
+}
+
+/**
+ * table_is_empty() - Check if a table is empty.
+ * @table: Table to check.
+ *
+ * Returns: True if table contains no key/value pairs, false otherwise.
+ */
+bool table_is_empty(const table *t)
+{
+    return t->size == 0;
+}
+
+/**
+ * table_insert() - Add a key/value pair to a table.
+ * @table: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Insert the key/value pair into the table. If the key is already in
+ * the table, its old key and value are de-allocated with the kill
+ * functions and replaced.
+ *
+ * Returns: Nothing.
+ */
+void table_insert(table *t, void *key, void *value)
+{
+    unsigned long hash = t->hashed ? slot_hash(t, key) : 0;
+    int i = find_slot(t, key, hash);
+
+    if (i >= 0) {
+        replace_slot(t, &t->slots[i], key, value);
+    } else {
+        add_entry(t, key, value, hash);
+    }
+}
+
+/**
+ * table_lookup() - Look up a given key in a table.
+ * @table: Table to inspect.
+ * @key: Key to look up.
+ *
+ * Returns: The value corresponding to a given key, or NULL if the key
+ * is not found in the table.
+ */
+void *table_lookup(const table *t, const void *key)
+{
+    unsigned long hash = t->hashed ? slot_hash(t, key) : 0;
+    int i = find_slot(t, key, hash);
+
+    return i >= 0 ? t->slots[i].value : NULL;
+}
+
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * See table_ext.h.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx)
+{
+    unsigned long hash = t->hashed ? slot_hash(t, key) : 0;
+    int i = find_slot(t, key, hash);
+
+    if (i >= 0) {
+        slot *s = &t->slots[i];
+        void *value = fn(s->value, true, ctx);
+        if (value != s->value && t->value_kill_func != NULL) {
+            t->value_kill_func(s->value);
+        }
+        s->value = value;
+        return value;
+    }
+
+    void *value = fn(NULL, false, ctx);
+    if (value != NULL) {
+        add_entry(t, key, value, hash);
+    }
+    return value;
+}
+
+/**
+ * table_choose_key() - Return an arbitrary key.
+ * @t: Table to inspect.
+ *
+ * Return an arbitrary key stored in the table. Can be used together
+ * with table_remove() to deconstruct the table. Undefined for an
+ * empty table.
+ *
+ * Returns: An arbitrary key stored in the table.
+ */
+void *table_choose_key(const table *t)
+{
+    if (!t->hashed) {
+        return t->slots[t->size - 1].key;
+    }
+
+    // Start where the last search ended, to make repeated
+    // choose/remove linear in the number of slots.
+    for (int n = 0; n < t->n_slots; n++) {
+        int i = (t->choose_hint + n) & slot_mask(t);
+        if (t->slots[i].hash != 0) {
+            ((table *)t)->choose_hint = i;
+            return t->slots[i].key;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * table_remove() - Remove a key/value pair in the table.
+ * @table: Table to manipulate.
+ * @key: Key for which to remove pair.
+ *
+ * Will call any kill functions set for keys/values. Does nothing if
+ * key is not found in the table.
+ *
+ * Returns: Nothing.
+ */
+void table_remove(table *t, const void *key)
+{
+    unsigned long hash = t->hashed ? slot_hash(t, key) : 0;
+    int i = find_slot(t, key, hash);
+
+    if (i < 0) {
+        return;
+    }
+
+    // Remove the slot first, since key may point to the stored key.
+    slot s = t->slots[i];
+    remove_slot(t, i);
+
+    if (t->key_kill_func != NULL) {
+        t->key_kill_func(s.key);
+    }
+    if (t->value_kill_func != NULL) {
+        t->value_kill_func(s.value);
+    }
+}
+
+/*
+ * table_kill() - Destroy a table.
+ * @table: Table to destroy.
+ *
+ * Return all dynamic memory used by the table and its elements. If a
+ * kill_func was registered for keys and/or values at table creation,
+ * it is called each element to kill any user-allocated memory
+ * occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void table_kill(table *t)
+{
+    for (int i = 0; i < (t->hashed ? t->n_slots : t->size); i++) {
+        slot *s = &t->slots[i];
+        if (t->hashed && s->hash == 0) {
+            continue;
+        }
+        if (t->key_kill_func != NULL) {
+            t->key_kill_func(s->key);
+        }
+        if (t->value_kill_func != NULL) {
+            t->value_kill_func(s->value);
+        }
+    }
+    free(t->slots);
+    free(t);
+}
+
+/**
+ * table_print() - Print the given table.
+ * @t: Table to print.
+ * @print_func: Function called for each key/value pair in the table.
+ *
+ * Iterates over the key/value pairs in the table and prints them.
+ *
+ * Returns: Nothing.
+ */
+void table_print(const table *t, inspect_callback_pair print_func)
+{
+    for (int i = 0; i < (t->hashed ? t->n_slots : t->size); i++) {
+        if (!t->hashed || t->slots[i].hash != 0) {
+            print_func(t->slots[i].key, t->slots[i].value);
+        }
+    }
+}
+
+// ===========INTERNAL FUNCTIONS USED BY table_print_internal ============
+
+// The functions below output code in the dot language, used by
+// GraphViz. For documention of the dot language, see graphviz.org.
+
+/**
+ * indent() - Output indentation string.
+ * @n: Indentation level.
+ *
+ * Print n tab characters.
+ *
+ * Returns: Nothing.
+ */
+static void indent(int n)
+{
+    for (int i=0; i<n; i++) {
+        printf("\t");
+    }
+}
+
+/**
+ * iprintf(...) - Indent and print.
+ * @n: Indentation level
+ * @...: printf arguments
+ *
+ * Print n tab characters and calls printf.
+ *
+ * Returns: Nothing.
+ */
+static void iprintf(int n, const char *fmt, ...)
+{
+    // Indent...
+    indent(n);
+    // ...and call printf
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * print_edge() - Print a edge between two addresses.
+ * @from: The address of the start of the edge. Should be non-NULL.
+ * @to: The address of the destination for the edge, including NULL.
+ * @port: The name of the port on the source node, or NULL.
+ * @label: The label for the edge, or NULL.
+ * @options: A string with other edge options, or NULL.
+ *
+ * Print an edge from port PORT on node FROM to TO with label
+ * LABEL. If to is NULL, the destination is the NULL node, otherwise a
+ * memory node. If the port is NULL, the edge starts at the node, not
+ * a specific port on it. If label is NULL, no label is used. The
+ * options string, if non-NULL, is printed before the label.
+ *
+ * Returns: Nothing.
+ */
+static void print_edge(int indent_level, const void *from, const void *to, const char *port,
+                       const char *label, const char *options)
+{
+    indent(indent_level);
+    if (port) {
+        printf("m%04lx:%s -> ", PTR2ADDR(from), port);
+    } else {
+        printf("m%04lx -> ", PTR2ADDR(from));
+    }
+    if (to == NULL) {
+        printf("NULL");
+    } else {
+        printf("m%04lx", PTR2ADDR(to));
+    }
+    printf(" [");
+    if (options != NULL) {
+        printf("%s", options);
+    }
+    if (label != NULL) {
+        printf(" label=\"%s\"",label);
+    }
+    printf("]\n");
+}
+
+/**
+ * print_head_node() - Print a node corresponding to the table struct.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ *
+ * Returns: Nothing.
+ */
+static void print_head_node(int indent_level, const table *t)
+{
+    iprintf(indent_level, "m%04lx [shape=record "
+            "label=\"slots\\n%04lx|n_slots\\n%d|size\\n%d|%s|cmp\\n%04lx|hash\\n%04lx"
+            "|key_kill\\n%04lx|value_kill\\n%04lx\"]\n",
+            PTR2ADDR(t), PTR2ADDR(t->slots), t->n_slots, t->size,
+            t->hashed ? "hashed" : "small", PTR2ADDR(t->key_cmp_func),
+            PTR2ADDR(t->key_hash_func), PTR2ADDR(t->key_kill_func),
+            PTR2ADDR(t->value_kill_func));
+}
+
+// Internal function to print the key and value nodes in dot format.
+static void print_key_value_nodes(int indent_level, const void *key, const void *value,
+                                  inspect_callback key_print_func,
+                                  inspect_callback value_print_func)
+{
+    if (key != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(key));
+        if (key_print_func != NULL) {
+            key_print_func(key);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(key));
+    }
+    if (value != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(value));
+        if (value_print_func != NULL) {
+            value_print_func(value);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(value));
+    }
+}
+
+/**
+ * print_entry() - Print one entry in dot format.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ * @e: Address of the entry, used as the name of its node.
+ * @i: Position of the entry in the printout.
+ * @key: Key of the entry.
+ * @value: Value of the entry.
+ * @key_print_func: Function called for the key.
+ * @value_print_func: Function called for the value.
+ * @payload: If true, print the key and value nodes, otherwise the
+ *           entry node and its edges.
+ *
+ * The entry is drawn as an edge from the head node labelled with its
+ * position. Memory "owned" by the table is indicated by solid red
+ * lines. Memory "borrowed" from the user is indicated by red dashed
+ * lines.
+ *
+ * Returns: Nothing.
+ */
+static void print_entry(int indent_level, const table *t, const void *e, int i,
+                        const void *key, const void *value,
+                        inspect_callback key_print_func,
+                        inspect_callback value_print_func, bool payload)
+{
+    if (payload) {
+        print_key_value_nodes(indent_level, key, value, key_print_func, value_print_func);
+        return;
+    }
+    char label[16];
+    snprintf(label, sizeof(label), "%d", i);
+
+    iprintf(indent_level, "m%04lx [shape=record label=\"<k>key\\n%04lx|<v>value\\n%04lx\"]\n",
+            PTR2ADDR(e), PTR2ADDR(key), PTR2ADDR(value));
+    print_edge(indent_level, t, e, NULL, label, NULL);
+    if (key == NULL) {
+        print_edge(indent_level, e, key, "k", "key", NULL);
+    } else if (t->key_kill_func) {
+        print_edge(indent_level, e, key, "k", "key", "color=red");
+    } else {
+        print_edge(indent_level, e, key, "k", "key", "color=red style=dashed");
+    }
+    if (value == NULL) {
+        print_edge(indent_level, e, value, "v", "value", NULL);
+    } else if (t->value_kill_func) {
+        print_edge(indent_level, e, value, "v", "value", "color=red");
+    } else {
+        print_edge(indent_level, e, value, "v", "value", "color=red style=dashed");
+    }
+}
+
+// Internal function to print the used slots in dot format.
+static void print_entries(int indent_level, const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, bool payload)
+{
+    for (int i = 0; i < (t->hashed ? t->n_slots : t->size); i++) {
+        if (!t->hashed || t->slots[i].hash != 0) {
+            print_entry(indent_level, t, &t->slots[i], i, t->slots[i].key, t->slots[i].value,
+                        key_print_func, value_print_func, payload);
+        }
+    }
+}
+
+// Create an escaped version of the input string. The most common
+// control characters - newline, horizontal tab, backslash, and double
+// quote - are replaced by their escape sequence. The returned pointer
+// must be deallocated by the caller.
+static char *escape_chars(const char *s)
+{
+    int i, j;
+    int escaped = 0; // The number of chars that must be escaped.
+
+    // Count how many chars need to be escaped, i.e. how much longer
+    // the output string will be.
+    for (i = escaped = 0; s[i] != '\0'; i++) {
+        if (s[i] == '\n' || s[i] == '\t' || s[i] == '\\' || s[i] == '\"') {
+            escaped++;
+        }
+    }
+    // Allocate space for the escaped string. The variable i holds the input
+    // length, escaped how much the string will grow.
+    char *t = malloc(i + escaped + 1);
+
+    // Copy-and-escape loop
+    for (i = j = 0; s[i] != '\0'; i++) {
+        // Convert each control character by its escape sequence.
+        // Non-control characters are copied as-is.
+        switch (s[i]) {
+        case '\n': t[i+j] = '\\'; t[i+j+1] = 'n';  j++; break;
+        case '\t': t[i+j] = '\\'; t[i+j+1] = 't';  j++; break;
+        case '\\': t[i+j] = '\\'; t[i+j+1] = '\\'; j++; break;
+        case '\"': t[i+j] = '\\'; t[i+j+1] = '\"'; j++; break;
+        default:   t[i+j] = s[i]; break;
+        }
+    }
+    // Terminal the output string
+    t[i+j] = '\0';
+    return t;
+}
+
+/**
+ * first_white_spc() - Return pointer to first white-space char.
+ * @s: String.
+ *
+ * Returns: A pointer to the first white-space char in s, or NULL if none is found.
+ *
+ */
+static const char *find_white_spc(const char *s)
+{
+    const char *t = s;
+    while (*t != '\0') {
+        if (isspace(*t)) {
+            // We found a white-space char, return a point to it.
+            return t;
+        }
+        // Advance to next char
+        t++;
+    }
+    // No white-space found
+    return NULL;
+}
+
+/**
+ * insert_table_name() - Maybe insert the name of the table src file in the description string.
+ * @s: Description string.
+ *
+ * Parses the description string to find of if it starts with a c file
+ * name. In that case, the file name of this file is spliced into the
+ * description string. The parsing is not very intelligent: If the
+ * sequence ".c:" (case insensitive) is found before the first
+ * white-space, the string up to and including ".c" is taken to be a c
+ * file name.
+ *
+ * Returns: A dynamic copy of s, optionally including with the table src file name.
+ */
+static char *insert_table_name(const char *s)
+{
+    // First, determine if the description string starts with a c file name
+    // a) Search for the string ".c:"
+    const char *dot_c = strstr(s, ".c:");
+    // b) Search for the first white-space
+    const char *spc = find_white_spc(s);
+
+    bool prefix_found;
+    int output_length;
+
+    // If both a) and b) are found AND a) is before b, we assume that
+    // s starts with a file name
+    if (dot_c != NULL && spc != NULL && dot_c < spc) {
+        // We found a match. Output string is input + 3 chars + __FILE__
+        prefix_found = true;
+        output_length = strlen(s) + 3 + strlen(__FILE__);
+    } else {
+        // No match found. Output string is just input
+        prefix_found = false;
+        output_length = strlen(s);
+    }
+
+    // Allocate space for the whole string
+    char *out = calloc(1, output_length + 1);
+    strcpy(out, s);
+    if (prefix_found) {
+        // Overwrite the output buffer from the ":"
+        strcpy(out + (dot_c - s + 2), " (");
+        // Now out will be 0-terminated after "(", append the file name and ")"
+        strcat(out, __FILE__);
+        strcat(out, ")");
+        // Finally append the input string from the : onwards
+        strcat(out, dot_c + 2);
+    }
+    return out;
+}
+
+/**
+ * table_print_internal() - Output the internal structure of the table.
+ * @t: Table to print.
+ * @key_print_func: Function called for each key in the table.
+ * @value_print_func: Function called for each value in the table.
+ * @desc: String with a description/state of the list.
+ * @indent_level: Indentation level, 0 for outermost
+ *
+ * Prints code that shows the used slots, each as an edge from the
+ * table struct labelled with its slot index. The head node shows if
+ * the table is in the small or the hashed layout.
+ *
+ * Returns: Nothing.
+ */
+void table_print_internal(const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, const char *desc,
+                          int indent_level)
+{
+    static int graph_number = 0;
+    graph_number++;
+    int il = indent_level;
+
+    if (indent_level == 0) {
+        // If this is the outermost datatype, start a graph and set up defaults
+        printf("digraph TABLE_%d {\n", graph_number);
+
+        // Specify default shape and fontname
+        il++;
+        iprintf(il, "node [shape=rectangle fontname=\"Courier New\"]\n");
+        iprintf(il, "ranksep=0.01\n");
+        iprintf(il, "subgraph cluster_nullspace {\n");
+        iprintf(il+1, "NULL\n");
+        iprintf(il, "}\n");
+    }
+
+    if (desc != NULL) {
+        // Escape the string before printout
+        char *escaped = escape_chars(desc);
+        // Optionally, splice the source file name
+        char *spliced = insert_table_name(escaped);
+
+        // Use different names on inner description nodes
+        if (indent_level == 0) {
+            iprintf(il, "description [label=\"%s\"]\n", spliced);
+        } else {
+            iprintf(il, "\tcluster_list_%d_description [label=\"%s\"]\n", graph_number, spliced);
+        }
+        // Return the memory used by the spliced and escaped strings
+        free(spliced);
+        free(escaped);
+    }
+
+    if (indent_level == 0) {
+        // Use a single "pointer" edge as a starting point for the
+        // outermost datatype
+        iprintf(il, "t [label=\"%04lx\" xlabel=\"t\"]\n", PTR2ADDR(t));
+        iprintf(il, "t -> m%04lx\n", PTR2ADDR(t));
+    }
+
+    if (indent_level == 0) {
+        // Put the user nodes in userspace
+        iprintf(il, "subgraph cluster_userspace { label=\"User space\"\n");
+        il++;
+
+        // Print the key and value nodes
+        print_entries(il, t, key_print_func, value_print_func, true);
+
+        // Close the subgraph
+        il--;
+        iprintf(il, "}\n");
+    }
+
+    // Print the subgraph to surround the table content
+    iprintf(il, "subgraph cluster_table_%d { label=\"Table\"\n", graph_number);
+    il++;
+
+    // Output the head node
+    print_head_node(il, t);
+
+    // Output the entries and their edges
+    print_entries(il, t, key_print_func, value_print_func, false);
+
+    // Close the subgraph
+    il--;
+    iprintf(il, "}\n");
+
+    if (indent_level == 0) {
+        // Termination of graph
+        printf("}\n");
+    }
+}
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "table_ext.h"
+#include "int_fixture.h"
+
+/**
+ * hybridtable_test.c - Tests for the layout changes of hybridtable.c.
+ *
+ * This file contains tests that grow and shrink a hybrid table across
+ * the sizes where it converts between the small array and the hash
+ * table, and where the hash table is resized. After every operation
+ * all keys are looked up, so an entry lost by a conversion or by the
+ * removal from the hash table is detected. The plain table.h
+ * operations are covered by table_difftest.c. Each test terminates
+ * the program with an error message if it fails.
+ *
+ * Compile with: gcc -I<include> hybridtable_test.c hybridtable.c table_ext.c int_fixture.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Use compare_int and the fixtures of int_fixture.c.
+ */
+
+// Number of keys. Large enough for the hash table to double a few
+// times.
+#define N 2000
+
+// Hash function that puts every key in a few probe sequences, so that
+// removals shift long runs of entries.
+static unsigned long hash_clustered(const void *key)
+{
+    return *(const int *)key % 5;
+}
+
+/**
+ * check_keys() - Check the contents of a table.
+ * @t: Table of the keys lo..hi-1 with values equal to the keys.
+ * @lo: Smallest key in the table.
+ * @hi: One past the largest key in the table.
+ * @limit: One past the largest key that may have been inserted.
+ *
+ * Returns: Nothing.
+ */
+static void check_keys(const table *t, int lo, int hi, int limit)
+{
+    for (int k = 0; k < limit; k++) {
+        int *v = table_lookup(t, &k);
+        bool present = k >= lo && k < hi;
+        if (present != (v != NULL) || (present && *v != k)) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: with the keys %d..%d, lookup of %d returned %d.\n", lo,
+                    hi - 1, k, v == NULL ? -1 : *v);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (table_is_empty(t) != (lo == hi)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: with the keys %d..%d, table_is_empty is wrong.\n", lo, hi - 1);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * grow_shrink_test() - Test growing and shrinking across the thresholds.
+ * @hash: Hash function of the table, or NULL.
+ *
+ * Inserts N keys one at a time and removes them again, from the
+ * smallest key, checking the table after each step. Then grows and
+ * shrinks it around the size where the layout changes.
+ */
+void grow_shrink_test(hash_function *hash)
+{
+    fprintf(stderr, "Starting grow_shrink_test()...");
+
+    table *t = table_empty_hashed(compare_int, hash, kill_int, kill_int);
+    int limit = N + 1;
+
+    for (int k = 0; k < N; k++) {
+        table_insert(t, new_int(k), new_int(k));
+        if (k < 100 || k % 97 == 0) {
+            check_keys(t, 0, k + 1, limit);
+        }
+    }
+    check_keys(t, 0, N, limit);
+    for (int k = 0; k < N; k++) {
+        table_remove(t, &k);
+        if (N - k < 100 || k % 97 == 0) {
+            check_keys(t, k + 1, N, limit);
+        }
+    }
+
+    // Around the conversions, both ways, many times.
+    for (int round = 0; round < 20; round++) {
+        for (int k = 0; k < 24; k++) {
+            table_insert(t, new_int(k), new_int(k));
+        }
+        check_keys(t, 0, 24, limit);
+        for (int k = 23; k >= 4; k--) {
+            table_remove(t, &k);
+        }
+        check_keys(t, 0, 4, limit);
+        for (int k = 0; k < 4; k++) {
+            table_remove(t, &k);
+        }
+    }
+    check_keys(t, 0, 0, limit);
+
+    table_kill(t);
+    check_ints_killed();
+
+    fprintf(stderr, "Test succeeded: all keys were found at all sizes.\n");
+}
+
+/**
+ * replace_kill_test() - Test replacing keys in both layouts.
+ *
+ * Replacing a key must kill the old key and value once, and
+ * table_kill() must kill the rest, whatever the layout.
+ */
+void replace_kill_test(void)
+{
+    fprintf(stderr, "Starting replace_kill_test()...");
+
+    for (int n = 1; n <= 200; n *= 3) {
+        table *t = table_empty_hashed(compare_int, hash_int, kill_int, kill_int);
+        ints_allocated = 0;
+        ints_killed = 0;
+
+        for (int k = 0; k < n; k++) {
+            table_insert(t, new_int(k), new_int(k));
+        }
+        for (int k = 0; k < n; k++) {
+            table_insert(t, new_int(k), new_int(k));
+        }
+        if (ints_killed != 2 * n) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: replacing %d keys killed %ld keys and values.\n", n, ints_killed);
+            exit(EXIT_FAILURE);
+        }
+        check_keys(t, 0, n, n);
+
+        // Empty the table with table_choose_key, as a user would.
+        int removed = 0;
+        while (!table_is_empty(t) && removed <= n) {
+            table_remove(t, table_choose_key(t));
+            removed++;
+        }
+        if (removed != n) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: a table of %d keys was emptied by %d removals.\n", n,
+                    removed);
+            exit(EXIT_FAILURE);
+        }
+        table_kill(t);
+        check_ints_killed();
+    }
+
+    fprintf(stderr, "Test succeeded: replaced keys and values were killed once.\n");
+}
+
+int main(void)
+{
+    grow_shrink_test(hash_int);        // Test a table with a good hash function
+    grow_shrink_test(hash_clustered);  // Test long probe sequences
+    grow_shrink_test(NULL);            // Test a table that never hashes
+    replace_kill_test();               // Test replacing and killing
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
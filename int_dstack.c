@@ -0,0 +1,281 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "int_dstack.h"
+#include "int_scan.h"
+
+// Number of elements allocated for a new stack.
+#define INITIAL_CAPACITY 16
+
+/*
+ * Implementation of a growable integer stack for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * The elements are stored in a contiguous array with the bottom
+ * element first. The array is doubled with realloc when full. Since
+ * the storage is contiguous, runs of values are moved with memcpy,
+ * and the scans run over the array with the vector code in int_scan.c.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: Added bulk push/pop and a view of the top elements.
+ *   v1.2  2026-10-18: Added read-only scans.
+ */
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * reserve() - Make room for a number of additional elements.
+ * @s: Stack to manipulate.
+ * @n: Number of elements to make room for.
+ *
+ * Returns: Nothing.
+ */
+static void reserve(int_dstack *s, int n)
+{
+    if (s->first_free_pos + n <= s->capacity) {
+        return;
+    }
+    // Double the storage until it is large enough.
+    while (s->first_free_pos + n > s->capacity) {
+        s->capacity *= 2;
+    }
+    s->elements = realloc(s->elements, s->capacity * sizeof(int));
+}
+
+/**
+ * int_dstack_empty() - Create an empty stack.
+ *
+ * Returns: A pointer to the new stack.
+ */
+int_dstack *int_dstack_empty(void)
+{
+    int_dstack *s = malloc(sizeof(*s));
+
+    s->elements = malloc(INITIAL_CAPACITY * sizeof(int));
+    s->first_free_pos = 0;
+    s->capacity = INITIAL_CAPACITY;
+
+    return s;
+}
+
+/**
+ * int_dstack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool int_dstack_is_empty(const int_dstack *s)
+{
+    return s->first_free_pos == 0;
+}
+
+/**
+ * int_dstack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value to be put on the stack.
+ *
+ * Returns: The modified stack.
+ */
+int_dstack *int_dstack_push(int_dstack *s, int v)
+{
+    reserve(s, 1);
+    s->elements[s->first_free_pos++] = v;
+
+    return s;
+}
+
+/**
+ * int_dstack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * Returns: The modified stack.
+ */
+int_dstack *int_dstack_pop(int_dstack *s)
+{
+    if (int_dstack_is_empty(s)) {
+        fprintf(stderr, "int_dstack_pop: Warning: pop on empty stack\n");
+        return s;
+    }
+    s->first_free_pos--;
+
+    return s;
+}
+
+/**
+ * int_dstack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack, or 0 for an empty stack.
+ */
+int int_dstack_top(const int_dstack *s)
+{
+    if (int_dstack_is_empty(s)) {
+        fprintf(stderr, "int_dstack_top: Warning: top on empty stack\n");
+        return 0;
+    }
+    return s->elements[s->first_free_pos - 1];
+}
+
+/**
+ * int_dstack_push_n() - Push an array of values on top of a stack.
+ * @s: Stack to manipulate.
+ * @src: Values to push.
+ * @n: Number of values to push.
+ *
+ * Returns: The modified stack.
+ */
+int_dstack *int_dstack_push_n(int_dstack *s, const int *src, int n)
+{
+    reserve(s, n);
+    memcpy(s->elements + s->first_free_pos, src, n * sizeof(int));
+    s->first_free_pos += n;
+
+    return s;
+}
+
+/**
+ * int_dstack_pop_n() - Remove the top values of a stack into an array.
+ * @s: Stack to manipulate.
+ * @dst: Array to store the removed values in.
+ * @n: Number of values to remove.
+ *
+ * Returns: The number of values removed.
+ */
+int int_dstack_pop_n(int_dstack *s, int *dst, int n)
+{
+    if (n > s->first_free_pos) {
+        n = s->first_free_pos;
+    }
+    s->first_free_pos -= n;
+    memcpy(dst, s->elements + s->first_free_pos, n * sizeof(int));
+
+    return n;
+}
+
+/**
+ * int_dstack_top_n() - Inspect the top values of a stack.
+ * @s: Stack to inspect.
+ * @k: Number of values to inspect.
+ *
+ * Returns: A pointer to the k top values, or NULL if the stack holds
+ * fewer than k values.
+ */
+const int *int_dstack_top_n(const int_dstack *s, int k)
+{
+    if (k > s->first_free_pos) {
+        return NULL;
+    }
+    return s->elements + s->first_free_pos - k;
+}
+
+/**
+ * int_dstack_size() - Return the number of elements on a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The number of elements on the stack.
+ */
+int int_dstack_size(const int_dstack *s)
+{
+    return s->first_free_pos;
+}
+
+/**
+ * int_dstack_sum() - Sum the elements of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The sum of all elements, 0 for an empty stack.
+ */
+long long int_dstack_sum(const int_dstack *s)
+{
+    return int_scan_sum(s->elements, s->first_free_pos);
+}
+
+/**
+ * int_dstack_min() - Find the smallest element of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The smallest element, or 0 for an empty stack.
+ */
+int int_dstack_min(const int_dstack *s)
+{
+    if (int_dstack_is_empty(s)) {
+        fprintf(stderr, "int_dstack_min: Warning: min on empty stack\n");
+        return 0;
+    }
+    return int_scan_min(s->elements, s->first_free_pos);
+}
+
+/**
+ * int_dstack_max() - Find the largest element of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The largest element, or 0 for an empty stack.
+ */
+int int_dstack_max(const int_dstack *s)
+{
+    if (int_dstack_is_empty(s)) {
+        fprintf(stderr, "int_dstack_max: Warning: max on empty stack\n");
+        return 0;
+    }
+    return int_scan_max(s->elements, s->first_free_pos);
+}
+
+/**
+ * int_dstack_contains() - Check if a value is on a stack.
+ * @s: Stack to inspect.
+ * @v: Value to look for.
+ *
+ * Returns: True if v is on the stack, otherwise false.
+ */
+bool int_dstack_contains(const int_dstack *s, int v)
+{
+    return int_scan_find_last(s->elements, s->first_free_pos, v) >= 0;
+}
+
+/**
+ * int_dstack_find() - Find the topmost occurrence of a value on a stack.
+ * @s: Stack to inspect.
+ * @v: Value to look for.
+ *
+ * Returns: The depth of the topmost occurrence of v, or -1 if v is
+ *          not on the stack.
+ */
+int int_dstack_find(const int_dstack *s, int v)
+{
+    int i = int_scan_find_last(s->elements, s->first_free_pos, v);
+
+    return i < 0 ? -1 : s->first_free_pos - 1 - i;
+}
+
+/**
+ * int_dstack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Returns: Nothing.
+ */
+void int_dstack_kill(int_dstack *s)
+{
+    free(s->elements);
+    free(s);
+}
+
+/**
+ * int_dstack_print() - Print all elements of a stack, top first.
+ * @s: Stack to print.
+ *
+ * Returns: Nothing.
+ */
+void int_dstack_print(const int_dstack *s)
+{
+    printf("{ ");
+    for (int i = s->first_free_pos - 1; i >= 0; i--) {
+        printf("[%d]", s->elements[i]);
+        if (i > 0) {
+            printf(", ");
+        }
+    }
+    printf(" }\n");
+}
@@ -0,0 +1,191 @@
+#ifndef __INT_DSTACK_H
+#define __INT_DSTACK_H
+
+#include <stdbool.h>
+
+/*
+ * Declaration of a growable integer stack for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * The stack in int_stack.h is a value type with a fixed capacity;
+ * every push, pop and top copies the whole struct in and out of the
+ * function. The stack declared here is operated on through a pointer
+ * and its storage grows as needed, so each operation only touches the
+ * top element. The two stacks can be used side by side.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: Added bulk push/pop and a view of the top elements.
+ *   v1.2  2026-10-18: Added read-only scans (see int_scan.h).
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// The stack struct is visible to allow inspection in tests, but
+// should only be manipulated through the functions below.
+typedef struct int_dstack {
+    int *elements; // Contiguous storage, bottom element first
+    int first_free_pos; // Number of elements on the stack
+    int capacity; // Number of allocated elements
+} int_dstack;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * int_dstack_empty() - Create an empty stack.
+ *
+ * Returns: A pointer to the new stack.
+ */
+int_dstack *int_dstack_empty(void);
+
+/**
+ * int_dstack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool int_dstack_is_empty(const int_dstack *s);
+
+/**
+ * int_dstack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value to be put on the stack.
+ *
+ * The storage is doubled when full.
+ *
+ * Returns: The modified stack.
+ */
+int_dstack *int_dstack_push(int_dstack *s, int v);
+
+/**
+ * int_dstack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * NOTE: Undefined for an empty stack.
+ *
+ * Returns: The modified stack.
+ */
+int_dstack *int_dstack_pop(int_dstack *s);
+
+/**
+ * int_dstack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack.
+ *          NOTE: The return value is undefined for an empty stack.
+ */
+int int_dstack_top(const int_dstack *s);
+
+/**
+ * int_dstack_push_n() - Push an array of values on top of a stack.
+ * @s: Stack to manipulate.
+ * @src: Values to push.
+ * @n: Number of values to push.
+ *
+ * Equivalent to pushing src[0], src[1], ..., src[n-1] in order, i.e.
+ * src[n-1] ends up on top. The values are copied with one memcpy.
+ *
+ * Returns: The modified stack.
+ */
+int_dstack *int_dstack_push_n(int_dstack *s, const int *src, int n);
+
+/**
+ * int_dstack_pop_n() - Remove the top values of a stack into an array.
+ * @s: Stack to manipulate.
+ * @dst: Array to store the removed values in. Must have room for n values.
+ * @n: Number of values to remove.
+ *
+ * The values are stored in the order they were pushed, i.e. the
+ * former top element ends up in dst[n-1]. int_dstack_pop_n() thus
+ * undoes int_dstack_push_n() with the same n. If the stack holds
+ * fewer than n values, all values are removed.
+ *
+ * Returns: The number of values removed.
+ */
+int int_dstack_pop_n(int_dstack *s, int *dst, int n);
+
+/**
+ * int_dstack_top_n() - Inspect the top values of a stack.
+ * @s: Stack to inspect.
+ * @k: Number of values to inspect.
+ *
+ * The returned array holds the k top values in the order they were
+ * pushed, i.e. element k-1 is the top element. The array is owned by
+ * the stack and is only valid until the stack is modified.
+ *
+ * Returns: A pointer to the k top values, or NULL if the stack holds
+ * fewer than k values.
+ */
+const int *int_dstack_top_n(const int_dstack *s, int k);
+
+/**
+ * int_dstack_size() - Return the number of elements on a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The number of elements on the stack.
+ */
+int int_dstack_size(const int_dstack *s);
+
+/**
+ * int_dstack_sum() - Sum the elements of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The sum of all elements, 0 for an empty stack.
+ */
+long long int_dstack_sum(const int_dstack *s);
+
+/**
+ * int_dstack_min() - Find the smallest element of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The smallest element.
+ *          NOTE: The return value is undefined for an empty stack.
+ */
+int int_dstack_min(const int_dstack *s);
+
+/**
+ * int_dstack_max() - Find the largest element of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The largest element.
+ *          NOTE: The return value is undefined for an empty stack.
+ */
+int int_dstack_max(const int_dstack *s);
+
+/**
+ * int_dstack_contains() - Check if a value is on a stack.
+ * @s: Stack to inspect.
+ * @v: Value to look for.
+ *
+ * Returns: True if v is on the stack, otherwise false.
+ */
+bool int_dstack_contains(const int_dstack *s, int v);
+
+/**
+ * int_dstack_find() - Find the topmost occurrence of a value on a stack.
+ * @s: Stack to inspect.
+ * @v: Value to look for.
+ *
+ * Returns: The depth of the topmost occurrence of v, where 0 is the
+ *          top element, or -1 if v is not on the stack.
+ */
+int int_dstack_find(const int_dstack *s, int v);
+
+/**
+ * int_dstack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Returns: Nothing.
+ */
+void int_dstack_kill(int_dstack *s);
+
+/**
+ * int_dstack_print() - Print all elements of a stack, top first.
+ * @s: Stack to print.
+ *
+ * Returns: Nothing.
+ */
+void int_dstack_print(const int_dstack *s);
+
+#endif
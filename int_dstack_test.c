@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include "int_dstack.h"
+#include "int_scan.h"
+
+/**
+ * int_dstack_test.c - Unit tests for the growable integer stack.
+ *
+ * This file contains unit tests for the integer stack operations
+ * declared in int_dstack.h. The tests cover creating an empty stack,
+ * pushing and popping integers, checking if the stack is empty,
+ * retrieving the top element and growing the storage. Each test
+ * terminates the program with an error message if it fails.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version with tests for int_dstack_empty,
+ *                  int_dstack_is_empty, int_dstack_top, int_dstack_push,
+ *                  int_dstack_pop and growth of the storage.
+ * 2026-10-18 v1.1: Added test for bulk push/pop and int_dstack_top_n.
+ * 2026-10-18 v1.2: Added test for the scans, run with each instruction set.
+ */
+
+/**
+ * empty_test() - Test the int_dstack_empty function.
+ *
+ * Creates an empty stack and verifies that int_dstack_is_empty()
+ * returns true for it.
+ */
+void empty_test(void)
+{
+    fprintf(stderr, "Starting empty_test()...");
+
+    int_dstack *s = int_dstack_empty();
+
+    if (s == NULL || !int_dstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_empty() failed to create empty stack.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: int_dstack_empty created an empty stack.\n");
+    int_dstack_kill(s);
+}
+
+/**
+ * is_empty_test() - Test the int_dstack_is_empty function.
+ *
+ * Pushes an element on an empty stack and checks that the stack is
+ * identified as non-empty.
+ */
+void is_empty_test(void)
+{
+    fprintf(stderr, "Starting is_empty_test()...");
+
+    int_dstack *s = int_dstack_empty();
+    s = int_dstack_push(s, 5);
+
+    if (int_dstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_is_empty failed to identify the non-empty stack.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: int_dstack_is_empty identified a non-empty stack.\n");
+    int_dstack_kill(s);
+}
+
+/**
+ * top_test() - Test the int_dstack_top function.
+ *
+ * Pushes two values and checks that int_dstack_top() returns the
+ * latest pushed value each time.
+ */
+void top_test(void)
+{
+    fprintf(stderr, "Starting top_test()...");
+
+    int_dstack *s = int_dstack_empty();
+    s = int_dstack_push(s, 5);
+
+    if (int_dstack_top(s) != 5) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_top returned %d, expected 5.\n", int_dstack_top(s));
+        exit(EXIT_FAILURE);
+    }
+
+    s = int_dstack_push(s, 4);
+
+    if (int_dstack_top(s) != 4) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_top returned %d, expected 4.\n", int_dstack_top(s));
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: int_dstack_top returned the top element.\n");
+    int_dstack_kill(s);
+}
+
+/**
+ * push_test() - Test the int_dstack_push function.
+ *
+ * Pushes two values, pops two and checks that the stack is empty,
+ * i.e. that no extra elements were added.
+ */
+void push_test(void)
+{
+    fprintf(stderr, "Starting push_test()...");
+
+    int_dstack *s = int_dstack_empty();
+    s = int_dstack_push(s, 4);
+    s = int_dstack_push(s, 5);
+
+    if (int_dstack_size(s) != 2) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_push gave size %d, expected 2.\n", int_dstack_size(s));
+        exit(EXIT_FAILURE);
+    }
+
+    s = int_dstack_pop(s);
+    s = int_dstack_pop(s);
+
+    if (!int_dstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_push placed too many values.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: int_dstack_push added elements to the stack.\n");
+    int_dstack_kill(s);
+}
+
+/**
+ * pop_test() - Test the int_dstack_pop function.
+ *
+ * Pushes two values, pops one and checks the remaining top element.
+ */
+void pop_test(void)
+{
+    fprintf(stderr, "Starting pop_test()...");
+
+    int_dstack *s = int_dstack_empty();
+    s = int_dstack_push(s, 5);
+    s = int_dstack_push(s, 4);
+    s = int_dstack_pop(s);
+
+    if (int_dstack_top(s) != 5) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_pop removed wrong value.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: int_dstack_pop removed the top element.\n");
+    int_dstack_kill(s);
+}
+
+/**
+ * grow_test() - Test that the storage grows.
+ *
+ * Pushes many more values than the initial capacity and checks that
+ * they are popped in reverse order.
+ */
+void grow_test(void)
+{
+    fprintf(stderr, "Starting grow_test()...");
+
+    int n = 100000;
+    int_dstack *s = int_dstack_empty();
+
+    for (int i = 0; i < n; i++) {
+        s = int_dstack_push(s, i);
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        if (int_dstack_top(s) != i) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: expected %d on top, got %d.\n", i, int_dstack_top(s));
+            exit(EXIT_FAILURE);
+        }
+        s = int_dstack_pop(s);
+    }
+
+    if (!int_dstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: stack not empty after popping all elements.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: the stack grew to %d elements.\n", n);
+    int_dstack_kill(s);
+}
+
+/**
+ * bulk_test() - Test int_dstack_push_n, int_dstack_pop_n and int_dstack_top_n.
+ *
+ * Pushes an array in bulk, checks the top elements through the view,
+ * and pops them back in bulk. The popped array must equal the pushed
+ * one, and popping more than the stack holds must stop at empty.
+ */
+void bulk_test(void)
+{
+    fprintf(stderr, "Starting bulk_test()...");
+
+    int src[100];
+    int dst[100];
+    for (int i = 0; i < 100; i++) {
+        src[i] = i * 3;
+    }
+
+    int_dstack *s = int_dstack_empty();
+    s = int_dstack_push(s, -1);
+    s = int_dstack_push_n(s, src, 100);
+
+    if (int_dstack_top(s) != src[99]) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_push_n left %d on top, expected %d.\n",
+                int_dstack_top(s), src[99]);
+        exit(EXIT_FAILURE);
+    }
+
+    const int *view = int_dstack_top_n(s, 3);
+    if (view == NULL || view[0] != src[97] || view[2] != src[99]) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_top_n returned the wrong elements.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (int_dstack_top_n(s, 102) != NULL) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_top_n returned a view larger than the stack.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (int_dstack_pop_n(s, dst, 100) != 100) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_pop_n removed the wrong number of values.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < 100; i++) {
+        if (dst[i] != src[i]) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: int_dstack_pop_n gave %d at %d, expected %d.\n",
+                    dst[i], i, src[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (int_dstack_pop_n(s, dst, 10) != 1 || dst[0] != -1 || !int_dstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: int_dstack_pop_n did not stop at an empty stack.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: bulk operations moved the elements in order.\n");
+    int_dstack_kill(s);
+}
+
+/**
+ * scan_test() - Test int_dstack_sum, min, max, contains and find.
+ *
+ * Compares the scans with simple loops on stacks of random values of
+ * many sizes, including sizes that are not a multiple of the vector
+ * width and values near INT_MIN and INT_MAX. The test is run with
+ * every instruction set the processor supports.
+ */
+void scan_test(void)
+{
+    fprintf(stderr, "Starting scan_test()...");
+
+    int_scan_isa tested = INT_SCAN_SCALAR;
+    for (int isa = INT_SCAN_SCALAR; isa <= INT_SCAN_AVX2; isa++) {
+        if (int_scan_set_isa(isa) != (int_scan_isa)isa) {
+            // Not supported by this processor.
+            continue;
+        }
+        tested = isa;
+        srand(isa);
+        for (int n = 1; n <= 1100; n = n < 40 ? n + 1 : n * 3) {
+            int_dstack *s = int_dstack_empty();
+            long long sum = 0;
+            int min = INT_MAX;
+            int max = INT_MIN;
+            for (int i = 0; i < n; i++) {
+                int v = rand() % 3 == 0 ? INT_MAX - rand() % 4 : -rand();
+                s = int_dstack_push(s, v);
+                sum += v;
+                min = v < min ? v : min;
+                max = v > max ? v : max;
+            }
+
+            // Look for a value at a random depth and for a missing one.
+            int depth = rand() % n;
+            int needle = s->elements[n - 1 - depth];
+            int expected = 0;
+            while (s->elements[n - 1 - expected] != needle) {
+                expected++;
+            }
+
+            if (int_dstack_sum(s) != sum || int_dstack_min(s) != min ||
+                int_dstack_max(s) != max || int_dstack_find(s, needle) != expected ||
+                !int_dstack_contains(s, needle) || int_dstack_find(s, 1) != -1 ||
+                int_dstack_contains(s, 1)) {
+                // Fail with error message
+                fprintf(stderr, "FAIL: %s scan gave a wrong result for %d elements.\n",
+                        int_scan_isa_name(isa), n);
+                exit(EXIT_FAILURE);
+            }
+            int_dstack_kill(s);
+        }
+    }
+
+    int_dstack *s = int_dstack_empty();
+    if (int_dstack_sum(s) != 0 || int_dstack_find(s, 0) != -1) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: scans on an empty stack gave a wrong result.\n");
+        exit(EXIT_FAILURE);
+    }
+    int_dstack_kill(s);
+
+    fprintf(stderr, "Test succeeded: scans matched simple loops up to %s.\n",
+            int_scan_isa_name(tested));
+}
+
+int main(void)
+{
+    empty_test();       // Test int_dstack_empty
+    is_empty_test();    // Test int_dstack_is_empty
+    top_test();         // Test int_dstack_top
+    push_test();        // Test int_dstack_push
+    pop_test();         // Test int_dstack_pop
+    grow_test();        // Test growth of the storage
+    bulk_test();        // Test bulk push/pop and int_dstack_top_n
+    scan_test();        // Test the scans
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
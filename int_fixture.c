@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "int_fixture.h"
+
+/*
+ * Implementation of the int keys and values shared by the table tests
+ * and benchmarks.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version, moved from the table tests.
+ */
+
+long ints_allocated = 0;
+long ints_killed = 0;
+
+// ==========INTERFACE==========
+
+/**
+ * compare_int() - Compare two int keys.
+ * @a: Pointer to the first int.
+ * @b: Pointer to the second int.
+ *
+ * The ints are compared, not subtracted, so the result cannot
+ * overflow.
+ *
+ * Returns: A negative, zero or positive value if a is less than, equal
+ *          to or greater than b.
+ */
+int compare_int(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * new_int() - Allocate an int.
+ * @v: Value of the int.
+ *
+ * Returns: A pointer to the new int.
+ */
+int *new_int(int v)
+{
+    int *p = malloc(sizeof(int));
+    *p = v;
+    ints_allocated++;
+    return p;
+}
+
+/**
+ * kill_int() - Free an int allocated by new_int().
+ * @p: Pointer to the int.
+ *
+ * Returns: Nothing.
+ */
+void kill_int(void *p)
+{
+    ints_killed++;
+    free(p);
+}
+
+/**
+ * check_ints_killed() - Check that every int has been freed.
+ *
+ * Returns: Nothing.
+ */
+void check_ints_killed(void)
+{
+    if (ints_killed != ints_allocated) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: %ld keys and values were allocated but %ld killed.\n",
+                ints_allocated, ints_killed);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * next_random() - Advance a xorshift generator.
+ * @state: Generator state, not 0.
+ *
+ * Returns: The next pseudo-random number.
+ */
+unsigned next_random(unsigned *state)
+{
+    unsigned x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
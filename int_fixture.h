@@ -0,0 +1,76 @@
+#ifndef INT_FIXTURE_H
+#define INT_FIXTURE_H
+
+/*
+ * Int keys and values shared by the table tests and benchmarks.
+ *
+ * compare_int() compares int keys, as hash_int() in table_ext.h
+ * hashes them. new_int() allocates an int and kill_int(), passed to
+ * the table as a kill function, frees it. Both are counted, so a test
+ * can check that the table freed every key and value it was given:
+ *
+ *   table *t = table_empty(compare_int, kill_int, kill_int);
+ *   table_insert(t, new_int(1), new_int(1));
+ *   ...
+ *   table_kill(t);
+ *   check_ints_killed();
+ *
+ * next_random() is a small generator that gives the same sequences
+ * with every C library, unlike rand().
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version, moved from the table tests.
+ */
+
+// ==========INTERFACE==========
+
+// Number of ints allocated by new_int() and freed by kill_int(). A
+// test may reset both to 0.
+extern long ints_allocated;
+extern long ints_killed;
+
+/**
+ * compare_int() - Compare two int keys.
+ * @a: Pointer to the first int.
+ * @b: Pointer to the second int.
+ *
+ * Returns: A negative, zero or positive value if a is less than, equal
+ *          to or greater than b.
+ */
+int compare_int(const void *a, const void *b);
+
+/**
+ * new_int() - Allocate an int.
+ * @v: Value of the int.
+ *
+ * Returns: A pointer to the new int.
+ */
+int *new_int(int v);
+
+/**
+ * kill_int() - Free an int allocated by new_int().
+ * @p: Pointer to the int.
+ *
+ * Returns: Nothing.
+ */
+void kill_int(void *p);
+
+/**
+ * check_ints_killed() - Check that every int has been freed.
+ *
+ * Terminates the program with an error message if ints_killed differs
+ * from ints_allocated.
+ *
+ * Returns: Nothing.
+ */
+void check_ints_killed(void);
+
+/**
+ * next_random() - Advance a xorshift generator.
+ * @state: Generator state, not 0.
+ *
+ * Returns: The next pseudo-random number.
+ */
+unsigned next_random(unsigned *state);
+
+#endif
@@ -0,0 +1,391 @@
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "int_scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HAVE_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * Implementation of read-only scans over integer arrays for the
+ * "Datastructures and algorithms" courses at the Department of
+ * Computing Science, Umea University.
+ *
+ * Each scan has a scalar version and, on x86, an SSE2 and an AVX2
+ * version compiled with the target attribute, so the file itself
+ * needs no special compiler flags. The version is chosen at the first
+ * call from __builtin_cpu_supports(). The vector versions process 4
+ * or 8 values per step and finish the remaining values with the
+ * scalar loop. SSE2 lacks 32-bit min/max and sign extension, which
+ * are emulated with compares and shifts.
+ *
+ * The scans may be called from several threads. Threads that make
+ * the first call at the same time all compute and store the same
+ * instruction set, so a relaxed atomic is enough.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: Made the instruction set choice thread safe.
+ */
+
+// The instruction set in use, or -1 before the first call.
+static _Atomic int current_isa = -1;
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * best_isa() - Find the best instruction set supported by the processor.
+ *
+ * Returns: The instruction set.
+ */
+static int_scan_isa best_isa(void)
+{
+#ifdef HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return INT_SCAN_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return INT_SCAN_SSE2;
+    }
+#endif
+    return INT_SCAN_SCALAR;
+}
+
+// Internal function to return the instruction set in use.
+static int_scan_isa active_isa(void)
+{
+    int isa = atomic_load_explicit(&current_isa, memory_order_relaxed);
+
+    if (isa < 0) {
+        isa = best_isa();
+        atomic_store_explicit(&current_isa, isa, memory_order_relaxed);
+    }
+    return isa;
+}
+
+// ===========SCALAR VERSIONS ============
+
+static long long scalar_sum(const int *a, int n)
+{
+    long long sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += a[i];
+    }
+    return sum;
+}
+
+static int scalar_min(const int *a, int n)
+{
+    int min = a[0];
+    for (int i = 1; i < n; i++) {
+        min = a[i] < min ? a[i] : min;
+    }
+    return min;
+}
+
+static int scalar_max(const int *a, int n)
+{
+    int max = a[0];
+    for (int i = 1; i < n; i++) {
+        max = a[i] > max ? a[i] : max;
+    }
+    return max;
+}
+
+static int scalar_find_last(const int *a, int n, int v)
+{
+    for (int i = n - 1; i >= 0; i--) {
+        if (a[i] == v) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef HAVE_X86
+
+// ===========SSE2 VERSIONS ============
+
+__attribute__((target("sse2")))
+static long long sse2_sum(const int *a, int n)
+{
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+        // Sign extend to 64 bits by interleaving with the sign bits.
+        __m128i sign = _mm_srai_epi32(x, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, sign));
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+
+    return lanes[0] + lanes[1] + scalar_sum(a + i, n - i);
+}
+
+// Internal function to select per lane from x where mask is set, else from y.
+__attribute__((target("sse2")))
+static __m128i sse2_select(__m128i mask, __m128i x, __m128i y)
+{
+    return _mm_or_si128(_mm_and_si128(mask, x), _mm_andnot_si128(mask, y));
+}
+
+__attribute__((target("sse2")))
+static int sse2_min(const int *a, int n)
+{
+    if (n < 4) {
+        return scalar_min(a, n);
+    }
+    __m128i acc = _mm_loadu_si128((const __m128i *)a);
+    int i = 4;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+        acc = sse2_select(_mm_cmplt_epi32(x, acc), x, acc);
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    int min = scalar_min(lanes, 4);
+
+    if (i < n) {
+        int tail = scalar_min(a + i, n - i);
+        min = tail < min ? tail : min;
+    }
+    return min;
+}
+
+__attribute__((target("sse2")))
+static int sse2_max(const int *a, int n)
+{
+    if (n < 4) {
+        return scalar_max(a, n);
+    }
+    __m128i acc = _mm_loadu_si128((const __m128i *)a);
+    int i = 4;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+        acc = sse2_select(_mm_cmpgt_epi32(x, acc), x, acc);
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    int max = scalar_max(lanes, 4);
+
+    if (i < n) {
+        int tail = scalar_max(a + i, n - i);
+        max = tail > max ? tail : max;
+    }
+    return max;
+}
+
+__attribute__((target("sse2")))
+static int sse2_find_last(const int *a, int n, int v)
+{
+    __m128i needle = _mm_set1_epi32(v);
+    int i = n;
+
+    // Scan blocks of 4 from the end, then the first n % 4 values.
+    for (; i >= 4; i -= 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + i - 4));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, needle)));
+        if (mask != 0) {
+            return i - 4 + 31 - __builtin_clz(mask);
+        }
+    }
+    return scalar_find_last(a, i, v);
+}
+
+// ===========AVX2 VERSIONS ============
+
+__attribute__((target("avx2")))
+static long long avx2_sum(const int *a, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i lo = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(a + i)));
+        __m256i hi = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(a + i + 4)));
+        acc = _mm256_add_epi64(acc, _mm256_add_epi64(lo, hi));
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar_sum(a + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static int avx2_min(const int *a, int n)
+{
+    if (n < 8) {
+        return scalar_min(a, n);
+    }
+    __m256i acc = _mm256_loadu_si256((const __m256i *)a);
+    int i = 8;
+
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_min_epi32(acc, _mm256_loadu_si256((const __m256i *)(a + i)));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int min = scalar_min(lanes, 8);
+
+    if (i < n) {
+        int tail = scalar_min(a + i, n - i);
+        min = tail < min ? tail : min;
+    }
+    return min;
+}
+
+__attribute__((target("avx2")))
+static int avx2_max(const int *a, int n)
+{
+    if (n < 8) {
+        return scalar_max(a, n);
+    }
+    __m256i acc = _mm256_loadu_si256((const __m256i *)a);
+    int i = 8;
+
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_max_epi32(acc, _mm256_loadu_si256((const __m256i *)(a + i)));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int max = scalar_max(lanes, 8);
+
+    if (i < n) {
+        int tail = scalar_max(a + i, n - i);
+        max = tail > max ? tail : max;
+    }
+    return max;
+}
+
+__attribute__((target("avx2")))
+static int avx2_find_last(const int *a, int n, int v)
+{
+    __m256i needle = _mm256_set1_epi32(v);
+    int i = n;
+
+    // Scan blocks of 8 from the end, then the first n % 8 values.
+    for (; i >= 8; i -= 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + i - 8));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, needle)));
+        if (mask != 0) {
+            return i - 8 + 31 - __builtin_clz(mask);
+        }
+    }
+    return scalar_find_last(a, i, v);
+}
+
+#endif
+
+// ===========DISPATCHING FUNCTIONS ============
+
+/**
+ * int_scan_sum() - Sum the values of an array.
+ * @a: Array to scan.
+ * @n: Number of values.
+ *
+ * Returns: The sum.
+ */
+long long int_scan_sum(const int *a, int n)
+{
+    switch (active_isa()) {
+#ifdef HAVE_X86
+    case INT_SCAN_AVX2: return avx2_sum(a, n);
+    case INT_SCAN_SSE2: return sse2_sum(a, n);
+#endif
+    default:            return scalar_sum(a, n);
+    }
+}
+
+/**
+ * int_scan_min() - Find the smallest value of an array.
+ * @a: Array to scan.
+ * @n: Number of values. Must be greater than 0.
+ *
+ * Returns: The smallest value.
+ */
+int int_scan_min(const int *a, int n)
+{
+    switch (active_isa()) {
+#ifdef HAVE_X86
+    case INT_SCAN_AVX2: return avx2_min(a, n);
+    case INT_SCAN_SSE2: return sse2_min(a, n);
+#endif
+    default:            return scalar_min(a, n);
+    }
+}
+
+/**
+ * int_scan_max() - Find the largest value of an array.
+ * @a: Array to scan.
+ * @n: Number of values. Must be greater than 0.
+ *
+ * Returns: The largest value.
+ */
+int int_scan_max(const int *a, int n)
+{
+    switch (active_isa()) {
+#ifdef HAVE_X86
+    case INT_SCAN_AVX2: return avx2_max(a, n);
+    case INT_SCAN_SSE2: return sse2_max(a, n);
+#endif
+    default:            return scalar_max(a, n);
+    }
+}
+
+/**
+ * int_scan_find_last() - Find the last occurrence of a value in an array.
+ * @a: Array to scan.
+ * @n: Number of values.
+ * @v: Value to look for.
+ *
+ * Returns: The largest index i with a[i] == v, or -1 if v is not found.
+ */
+int int_scan_find_last(const int *a, int n, int v)
+{
+    switch (active_isa()) {
+#ifdef HAVE_X86
+    case INT_SCAN_AVX2: return avx2_find_last(a, n, v);
+    case INT_SCAN_SSE2: return sse2_find_last(a, n, v);
+#endif
+    default:            return scalar_find_last(a, n, v);
+    }
+}
+
+/**
+ * int_scan_set_isa() - Choose the instruction set used by the scans.
+ * @isa: Instruction set to use.
+ *
+ * Returns: The instruction set actually used.
+ */
+int_scan_isa int_scan_set_isa(int_scan_isa isa)
+{
+    int_scan_isa best = best_isa();
+
+    int_scan_isa used = isa < best ? isa : best;
+
+    atomic_store_explicit(&current_isa, used, memory_order_relaxed);
+    return used;
+}
+
+/**
+ * int_scan_isa_name() - Return the name of an instruction set.
+ * @isa: Instruction set.
+ *
+ * Returns: A static string.
+ */
+const char *int_scan_isa_name(int_scan_isa isa)
+{
+    switch (isa) {
+    case INT_SCAN_AVX2: return "avx2";
+    case INT_SCAN_SSE2: return "sse2";
+    default:            return "scalar";
+    }
+}
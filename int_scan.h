@@ -0,0 +1,93 @@
+#ifndef __INT_SCAN_H
+#define __INT_SCAN_H
+
+#include <stdbool.h>
+
+/*
+ * Declaration of read-only scans over integer arrays for the
+ * "Datastructures and algorithms" courses at the Department of
+ * Computing Science, Umea University.
+ *
+ * The scans work on the contiguous storage of the integer stacks
+ * without modifying them. For the value stack in int_stack.h, pass
+ * s.elements and s.first_free_pos; the growable stack in int_dstack.h
+ * has wrapper functions.
+ *
+ * On x86 the scans use SSE2 or AVX2 instructions, chosen at run time
+ * from what the processor supports. Other platforms use plain loops.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// Instruction sets that the scans can use.
+typedef enum int_scan_isa {
+    INT_SCAN_SCALAR,
+    INT_SCAN_SSE2,
+    INT_SCAN_AVX2,
+} int_scan_isa;
+
+// ==========INTERFACE==========
+
+/**
+ * int_scan_sum() - Sum the values of an array.
+ * @a: Array to scan.
+ * @n: Number of values.
+ *
+ * Returns: The sum, computed without overflow for any n that fits in an int.
+ */
+long long int_scan_sum(const int *a, int n);
+
+/**
+ * int_scan_min() - Find the smallest value of an array.
+ * @a: Array to scan.
+ * @n: Number of values. Must be greater than 0.
+ *
+ * Returns: The smallest value.
+ */
+int int_scan_min(const int *a, int n);
+
+/**
+ * int_scan_max() - Find the largest value of an array.
+ * @a: Array to scan.
+ * @n: Number of values. Must be greater than 0.
+ *
+ * Returns: The largest value.
+ */
+int int_scan_max(const int *a, int n);
+
+/**
+ * int_scan_find_last() - Find the last occurrence of a value in an array.
+ * @a: Array to scan.
+ * @n: Number of values.
+ * @v: Value to look for.
+ *
+ * The array is scanned from the end, i.e. from the top of a stack.
+ *
+ * Returns: The largest index i with a[i] == v, or -1 if v is not found.
+ */
+int int_scan_find_last(const int *a, int n, int v);
+
+/**
+ * int_scan_set_isa() - Choose the instruction set used by the scans.
+ * @isa: Instruction set to use.
+ *
+ * Intended for tests and benchmarks. By default the best supported
+ * instruction set is used. Must not be called concurrently with scans.
+ *
+ * Returns: The instruction set actually used, which is lower than
+ *          isa if the processor does not support isa.
+ */
+int_scan_isa int_scan_set_isa(int_scan_isa isa);
+
+/**
+ * int_scan_isa_name() - Return the name of an instruction set.
+ * @isa: Instruction set.
+ *
+ * Returns: A static string, e.g. "avx2".
+ */
+const char *int_scan_isa_name(int_scan_isa isa);
+
+#endif
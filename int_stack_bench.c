@@ -0,0 +1,267 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_clock.h"
+#include "int_stack.h"
+#include "int_dstack.h"
+#include "int_scan.h"
+
+/**
+ * int_stack_bench.c - Benchmarks for the integer stacks.
+ *
+ * Compile with the value stack from the course library and the
+ * growable stack in this directory:
+ *
+ *   gcc -O2 -I<include> int_stack_bench.c int_stack.c int_dstack.c int_scan.c \
+ *       bench_clock.c
+ *
+ * Usage: int_stack_bench [n]
+ *
+ * Transfers n ints (default 10^6) from an array onto a stack and back
+ * into an array, in runs of RUN_LENGTH values:
+ *  - value:  one stack_push()/stack_pop() per int with int_stack.h,
+ *  - dstack: one int_dstack_push()/int_dstack_pop() per int,
+ *  - bulk:   one int_dstack_push_n()/int_dstack_pop_n() per run.
+ * The value stack can hold at most MAX_STACK_SIZE ints, which limits
+ * the run length.
+ *
+ * It then times the read-only scans (sum, min, max and find) on
+ * growable stacks of 10^3 to 10^7 elements with each supported
+ * instruction set, and a sum computed the old way by popping every
+ * element and pushing it back.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version comparing bulk and per-element transfer.
+ * 2026-10-18 v1.1: Added the scan benchmark.
+ * 2026-10-18 v1.2: Clock helpers moved to bench_clock.c.
+ */
+
+#define DEFAULT_N 1000000
+
+// Stack sizes of the scan benchmark and the number of elements
+// scanned per measurement.
+#define SCAN_MIN_SIZE 1000
+#define SCAN_MAX_SIZE 10000000
+#define SCAN_ELEMENTS 100000000LL
+
+// Receives the scan results so that the scans are not optimized away.
+static volatile long long scan_sink;
+
+// Number of values pushed before they are popped again.
+#define RUN_LENGTH MAX_STACK_SIZE
+
+// Internal function to verify that dst is a copy of src.
+static void check(const char *name, const int *src, const int *dst, int n)
+{
+    for (int i = 0; i < n; i++) {
+        if (src[i] != dst[i]) {
+            fprintf(stderr, "FAIL: %s transfer gave %d at %d, expected %d\n",
+                    name, dst[i], i, src[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+// Internal function to print the result of one transfer.
+static void report(const char *name, int n, long long ns)
+{
+    printf("%-6s n=%d %.2f ns/int\n", name, n, (double)ns / n);
+}
+
+/**
+ * value_transfer() - Transfer ints with the value stack.
+ * @src: Values to transfer.
+ * @dst: Destination array.
+ * @n: Number of values.
+ *
+ * Returns: The elapsed time in nanoseconds.
+ */
+static long long value_transfer(const int *src, int *dst, int n)
+{
+    stack s = stack_empty();
+
+    long long start = now_ns();
+    for (int i = 0; i < n; i += RUN_LENGTH) {
+        int len = n - i < RUN_LENGTH ? n - i : RUN_LENGTH;
+        for (int j = 0; j < len; j++) {
+            s = stack_push(s, src[i + j]);
+        }
+        for (int j = len - 1; j >= 0; j--) {
+            dst[i + j] = stack_top(s);
+            s = stack_pop(s);
+        }
+    }
+    return now_ns() - start;
+}
+
+/**
+ * dstack_transfer() - Transfer ints one at a time with the growable stack.
+ * @src: Values to transfer.
+ * @dst: Destination array.
+ * @n: Number of values.
+ *
+ * Returns: The elapsed time in nanoseconds.
+ */
+static long long dstack_transfer(const int *src, int *dst, int n)
+{
+    int_dstack *s = int_dstack_empty();
+
+    long long start = now_ns();
+    for (int i = 0; i < n; i += RUN_LENGTH) {
+        int len = n - i < RUN_LENGTH ? n - i : RUN_LENGTH;
+        for (int j = 0; j < len; j++) {
+            s = int_dstack_push(s, src[i + j]);
+        }
+        for (int j = len - 1; j >= 0; j--) {
+            dst[i + j] = int_dstack_top(s);
+            s = int_dstack_pop(s);
+        }
+    }
+    long long ns = now_ns() - start;
+
+    int_dstack_kill(s);
+    return ns;
+}
+
+/**
+ * bulk_transfer() - Transfer ints in runs with the growable stack.
+ * @src: Values to transfer.
+ * @dst: Destination array.
+ * @n: Number of values.
+ *
+ * Returns: The elapsed time in nanoseconds.
+ */
+static long long bulk_transfer(const int *src, int *dst, int n)
+{
+    int_dstack *s = int_dstack_empty();
+
+    long long start = now_ns();
+    for (int i = 0; i < n; i += RUN_LENGTH) {
+        int len = n - i < RUN_LENGTH ? n - i : RUN_LENGTH;
+        s = int_dstack_push_n(s, src + i, len);
+        int_dstack_pop_n(s, dst + i, len);
+    }
+    long long ns = now_ns() - start;
+
+    int_dstack_kill(s);
+    return ns;
+}
+
+/**
+ * pop_sum() - Sum a stack by popping every element and pushing it back.
+ * @s: Stack to sum. Restored to its original contents.
+ * @tmp: Array with room for all elements.
+ *
+ * Returns: The sum of the elements.
+ */
+static long long pop_sum(int_dstack *s, int *tmp)
+{
+    int n = int_dstack_size(s);
+    long long sum = 0;
+
+    for (int i = n - 1; i >= 0; i--) {
+        tmp[i] = int_dstack_top(s);
+        sum += tmp[i];
+        s = int_dstack_pop(s);
+    }
+    for (int i = 0; i < n; i++) {
+        s = int_dstack_push(s, tmp[i]);
+    }
+    return sum;
+}
+
+/**
+ * scan_bench() - Time the scans for one stack size.
+ * @size: Number of elements on the stack.
+ *
+ * Each scan is repeated until about SCAN_ELEMENTS elements have been
+ * scanned. find looks for a missing value, so it scans the whole stack.
+ *
+ * Returns: Nothing.
+ */
+static void scan_bench(int size)
+{
+    int_dstack *s = int_dstack_empty();
+    for (int i = 0; i < size; i++) {
+        s = int_dstack_push(s, rand());
+    }
+    long long reps = SCAN_ELEMENTS / size;
+    const char *ops[] = { "sum", "min", "max", "find" };
+    long long check = 0;
+
+    for (int op = 0; op < 4; op++) {
+        printf("scan   n=%-8d %-4s", size, ops[op]);
+        for (int isa = INT_SCAN_SCALAR; isa <= INT_SCAN_AVX2; isa++) {
+            if (int_scan_set_isa(isa) != (int_scan_isa)isa) {
+                continue;
+            }
+            long long start = now_ns();
+            for (long long r = 0; r < reps; r++) {
+                switch (op) {
+                case 0: check += int_dstack_sum(s);      break;
+                case 1: check += int_dstack_min(s);      break;
+                case 2: check += int_dstack_max(s);      break;
+                case 3: check += int_dstack_find(s, -1); break;
+                }
+            }
+            long long ns = now_ns() - start;
+            printf(" %s %.3f ns/int", int_scan_isa_name(isa), (double)ns / (reps * size));
+        }
+        printf("\n");
+    }
+
+    // The old way: pop everything and push it back.
+    int *tmp = malloc(size * sizeof(int));
+    reps = reps / 10 > 0 ? reps / 10 : 1;
+    long long start = now_ns();
+    for (long long r = 0; r < reps; r++) {
+        check += pop_sum(s, tmp);
+    }
+    long long ns = now_ns() - start;
+    printf("scan   n=%-8d sum  pop %.3f ns/int\n", size, (double)ns / (reps * size));
+
+    scan_sink = check;
+    free(tmp);
+    int_dstack_kill(s);
+}
+
+int main(int argc, char *argv[])
+{
+    int n = DEFAULT_N;
+
+    if (argc > 1) {
+        n = atoi(argv[1]);
+        if (n <= 0) {
+            fprintf(stderr, "Usage: %s [n]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    int *src = malloc(n * sizeof(int));
+    int *dst = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        src[i] = rand();
+    }
+
+    long long ns = value_transfer(src, dst, n);
+    check("value", src, dst, n);
+    report("value", n, ns);
+
+    ns = dstack_transfer(src, dst, n);
+    check("dstack", src, dst, n);
+    report("dstack", n, ns);
+
+    ns = bulk_transfer(src, dst, n);
+    check("bulk", src, dst, n);
+    report("bulk", n, ns);
+
+    for (int size = SCAN_MIN_SIZE; size <= SCAN_MAX_SIZE; size *= 10) {
+        scan_bench(size);
+    }
+
+    free(src);
+    free(dst);
+    return 0;
+}
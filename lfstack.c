@@ -0,0 +1,269 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "lfstack.h"
+
+// Number of nodes per allocated block.
+#define BLOCK_SIZE 4096
+
+// Maximum number of blocks. Index 0 is not used, so the blocks hold
+// LFSTACK_CAPACITY nodes.
+#define MAX_BLOCKS ((LFSTACK_CAPACITY + 1) / BLOCK_SIZE)
+
+/*
+ * Implementation of a lock-free generic stack (Treiber stack) for the
+ * "Datastructures and algorithms" courses at the Department of
+ * Computing Science, Umea University.
+ *
+ * The stack is a singly linked list of nodes whose head is swapped
+ * with compare-and-swap. To protect against the ABA problem, the head
+ * is a 64-bit word holding a 32-bit node index and a 32-bit tag that
+ * is incremented by every successful swap. A thread that read the
+ * head before a node was popped and pushed again will see a new tag
+ * and retry.
+ *
+ * Nodes are identified by their index in a pool of blocks. Popped
+ * nodes are put on a free list, itself a tagged Treiber stack, and
+ * the blocks are only returned by lfstack_kill(). A thread may thus
+ * read the next field of a node that was popped by another thread;
+ * the value is stale but the memory is valid, and the tag check
+ * rejects the swap. Index 0 is never used and means NULL.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: lfstack_push returns false when the stack is full
+ *                     instead of aborting.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct node {
+    _Atomic uint32_t next; // Index of the node below, or 0
+    void *value;
+} node;
+
+struct lfstack {
+    _Atomic uint64_t head; // Tag and index of the top node
+    _Atomic uint64_t free_head; // Tag and index of the first free node
+    _Atomic uint32_t next_index; // First never used node index
+    _Atomic(node *) *blocks; // Array of MAX_BLOCKS node blocks
+    kill_function kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+// Internal functions to pack and unpack a tagged node index.
+static uint64_t make_ref(uint32_t tag, uint32_t index)
+{
+    return (uint64_t)tag << 32 | index;
+}
+
+static uint32_t ref_tag(uint64_t ref)
+{
+    return (uint32_t)(ref >> 32);
+}
+
+static uint32_t ref_index(uint64_t ref)
+{
+    return (uint32_t)ref;
+}
+
+/**
+ * node_at() - Return the node with a given index.
+ * @s: Stack that owns the node.
+ * @i: Node index.
+ *
+ * Allocates the block holding the node if needed. Several threads
+ * may race to allocate the same block; only one of them wins and the
+ * others free their block.
+ *
+ * Returns: A pointer to the node.
+ */
+static node *node_at(lfstack *s, uint32_t i)
+{
+    _Atomic(node *) *slot = &s->blocks[i / BLOCK_SIZE];
+    node *b = atomic_load_explicit(slot, memory_order_acquire);
+
+    if (b == NULL) {
+        node *fresh = calloc(BLOCK_SIZE, sizeof(node));
+        if (atomic_compare_exchange_strong_explicit(slot, &b, fresh, memory_order_acq_rel,
+                                                    memory_order_acquire)) {
+            b = fresh;
+        } else {
+            // Another thread published the block first. Use that one.
+            free(fresh);
+        }
+    }
+    return &b[i % BLOCK_SIZE];
+}
+
+/**
+ * list_push() - Push a node on a tagged list.
+ * @s: Stack that owns the node.
+ * @head: Head of the list.
+ * @i: Index of the node to push.
+ *
+ * Returns: Nothing.
+ */
+static void list_push(lfstack *s, _Atomic uint64_t *head, uint32_t i)
+{
+    node *n = node_at(s, i);
+    uint64_t old = atomic_load_explicit(head, memory_order_relaxed);
+    uint64_t new;
+
+    do {
+        atomic_store_explicit(&n->next, ref_index(old), memory_order_relaxed);
+        new = make_ref(ref_tag(old) + 1, i);
+        // Release: the node contents must be visible to the thread that pops it.
+    } while (!atomic_compare_exchange_weak_explicit(head, &old, new, memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+/**
+ * list_pop() - Pop a node from a tagged list.
+ * @s: Stack that owns the nodes.
+ * @head: Head of the list.
+ *
+ * Returns: The index of the popped node, or 0 if the list was empty.
+ */
+static uint32_t list_pop(lfstack *s, _Atomic uint64_t *head)
+{
+    uint64_t old = atomic_load_explicit(head, memory_order_acquire);
+    uint64_t new;
+
+    do {
+        if (ref_index(old) == 0) {
+            return 0;
+        }
+        // The node may be popped and reused by another thread at any
+        // time. Then next is stale, but the tag makes the swap fail.
+        node *n = node_at(s, ref_index(old));
+        uint32_t next = atomic_load_explicit(&n->next, memory_order_relaxed);
+        new = make_ref(ref_tag(old) + 1, next);
+    } while (!atomic_compare_exchange_weak_explicit(head, &old, new, memory_order_acq_rel,
+                                                    memory_order_acquire));
+
+    return ref_index(old);
+}
+
+/**
+ * node_alloc() - Get an unused node index.
+ * @s: Stack that owns the nodes.
+ *
+ * Reuses a node from the free list if possible. Otherwise the next
+ * never used index is claimed. next_index stops at the first index
+ * past the pool, so failed calls do not advance it further.
+ *
+ * Returns: The index of the node, or 0 if the pool is exhausted.
+ */
+static uint32_t node_alloc(lfstack *s)
+{
+    uint32_t i = list_pop(s, &s->free_head);
+
+    if (i == 0) {
+        i = atomic_load_explicit(&s->next_index, memory_order_relaxed);
+        do {
+            if (i > LFSTACK_CAPACITY) {
+                return 0;
+            }
+        } while (!atomic_compare_exchange_weak_explicit(&s->next_index, &i, i + 1,
+                                                        memory_order_relaxed,
+                                                        memory_order_relaxed));
+    }
+    return i;
+}
+
+/**
+ * lfstack_empty() - Create an empty stack.
+ * @kill_func: A pointer to a function (or NULL) to be called to
+ *             de-allocate memory for the remaining elements on kill.
+ *
+ * Returns: A pointer to the new stack.
+ */
+lfstack *lfstack_empty(kill_function kill_func)
+{
+    lfstack *s = calloc(1, sizeof(*s));
+
+    atomic_init(&s->head, make_ref(0, 0));
+    atomic_init(&s->free_head, make_ref(0, 0));
+    // Index 0 means NULL and is never handed out.
+    atomic_init(&s->next_index, 1);
+    s->blocks = calloc(MAX_BLOCKS, sizeof(*s->blocks));
+    s->kill_func = kill_func;
+
+    return s;
+}
+
+/**
+ * lfstack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool lfstack_is_empty(const lfstack *s)
+{
+    return ref_index(atomic_load_explicit(&((lfstack *)s)->head, memory_order_acquire)) == 0;
+}
+
+/**
+ * lfstack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value (pointer) to be put on the stack.
+ *
+ * Returns: True if the value was pushed, false if the stack was full.
+ */
+bool lfstack_push(lfstack *s, void *v)
+{
+    uint32_t i = node_alloc(s);
+
+    if (i == 0) {
+        // All LFSTACK_CAPACITY nodes are in use.
+        return false;
+    }
+    node_at(s, i)->value = v;
+    list_push(s, &s->head, i);
+    return true;
+}
+
+/**
+ * lfstack_pop() - Remove and return the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * Returns: The removed element, or NULL if the stack was empty.
+ */
+void *lfstack_pop(lfstack *s)
+{
+    uint32_t i = list_pop(s, &s->head);
+
+    if (i == 0) {
+        return NULL;
+    }
+    // The node is ours now. Read the value before recycling it.
+    void *v = node_at(s, i)->value;
+    list_push(s, &s->free_head, i);
+
+    return v;
+}
+
+/**
+ * lfstack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Returns: Nothing.
+ */
+void lfstack_kill(lfstack *s)
+{
+    uint32_t i;
+
+    while ((i = list_pop(s, &s->head)) != 0) {
+        if (s->kill_func != NULL) {
+            s->kill_func(node_at(s, i)->value);
+        }
+    }
+    for (int b = 0; b < MAX_BLOCKS; b++) {
+        free(atomic_load(&s->blocks[b]));
+    }
+    free(s->blocks);
+    free(s);
+}
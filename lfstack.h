@@ -0,0 +1,98 @@
+#ifndef __LFSTACK_H
+#define __LFSTACK_H
+
+#include <stdbool.h>
+
+#include <util.h>
+
+/*
+ * Declaration of a lock-free generic stack for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * The stack can be shared between threads without a lock: any number
+ * of threads may call lfstack_push(), lfstack_pop() and
+ * lfstack_is_empty() concurrently. lfstack_empty() and lfstack_kill()
+ * must not run concurrently with other operations on the same stack.
+ *
+ * Unlike stack_pop() in stack.h, lfstack_pop() returns the removed
+ * element, since another thread may change the top between a
+ * separate top and pop. The caller takes over the element, and the
+ * kill function is only called by lfstack_kill() for the elements
+ * that remain on the stack.
+ *
+ * A stack holds at most LFSTACK_CAPACITY elements. lfstack_push()
+ * returns false when the stack is full.
+ *
+ * The implementation uses C11 atomics and must be compiled with
+ * -std=c11 or later.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: lfstack_push returns false when the stack is full.
+ */
+
+// Maximum number of elements on a stack, 2^24 - 1. The nodes are
+// numbered with 32-bit indices and allocated in blocks.
+#define LFSTACK_CAPACITY 16777215
+
+// ==========PUBLIC DATA TYPES============
+
+typedef struct lfstack lfstack;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * lfstack_empty() - Create an empty stack.
+ * @kill_func: A pointer to a function (or NULL) to be called to
+ *             de-allocate memory for the remaining elements on kill.
+ *
+ * Returns: A pointer to the new stack.
+ */
+lfstack *lfstack_empty(kill_function kill_func);
+
+/**
+ * lfstack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * With concurrent pushes and pops, the answer may be out of date as
+ * soon as it is returned.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool lfstack_is_empty(const lfstack *s);
+
+/**
+ * lfstack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value (pointer) to be put on the stack. Should not be NULL,
+ *     since lfstack_pop() uses NULL to signal an empty stack.
+ *
+ * The value is not pushed if LFSTACK_CAPACITY nodes are in use. A
+ * node popped by a concurrent lfstack_pop() may still be in use for
+ * a moment after the pop has taken the element.
+ *
+ * Returns: True if the value was pushed, false if the stack was full.
+ */
+bool lfstack_push(lfstack *s, void *v);
+
+/**
+ * lfstack_pop() - Remove and return the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * Returns: The removed element, or NULL if the stack was empty.
+ */
+void *lfstack_pop(lfstack *s);
+
+/**
+ * lfstack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Return all dynamic memory used by the stack. If a kill_func was
+ * registered at stack creation, it is called for each remaining element.
+ *
+ * Returns: Nothing.
+ */
+void lfstack_kill(lfstack *s);
+
+#endif
@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "lfstack.h"
+
+/**
+ * lfstack_test.c - Unit and stress tests for the lock-free stack.
+ *
+ * This file contains tests for the stack declared in lfstack.h. The
+ * single-threaded tests check the basic stack behaviour. The stress
+ * test lets several threads push and pop concurrently and checks that
+ * every pushed element is popped exactly once. Each test terminates
+ * the program with an error message if it fails.
+ *
+ * Compile with: gcc -std=c11 -pthread -I<include> lfstack_test.c lfstack.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Added capacity_test().
+ */
+
+// Number of threads and elements per thread in the stress test.
+#define THREADS 8
+#define ELEMENTS_PER_THREAD 200000
+
+/**
+ * empty_test() - Test lfstack_empty and lfstack_is_empty.
+ *
+ * Creates an empty stack, checks that it is empty, pushes an element
+ * and checks that it is no longer empty.
+ */
+void empty_test(void)
+{
+    fprintf(stderr, "Starting empty_test()...");
+
+    lfstack *s = lfstack_empty(NULL);
+    int v = 1;
+
+    if (!lfstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: lfstack_empty() failed to create empty stack.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    lfstack_push(s, &v);
+
+    if (lfstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: lfstack_is_empty failed to identify the non-empty stack.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: lfstack_is_empty identified empty and non-empty stacks.\n");
+    lfstack_kill(s);
+}
+
+/**
+ * push_pop_test() - Test lfstack_push and lfstack_pop.
+ *
+ * Pushes three elements and checks that they are popped in reverse
+ * order, and that a pop on the empty stack returns NULL.
+ */
+void push_pop_test(void)
+{
+    fprintf(stderr, "Starting push_pop_test()...");
+
+    lfstack *s = lfstack_empty(NULL);
+    int v[3] = { 10, 20, 30 };
+
+    for (int i = 0; i < 3; i++) {
+        lfstack_push(s, &v[i]);
+    }
+    for (int i = 2; i >= 0; i--) {
+        int *p = lfstack_pop(s);
+        if (p != &v[i]) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: lfstack_pop returned the wrong element.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (lfstack_pop(s) != NULL || !lfstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: lfstack_pop on an empty stack did not return NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: lfstack_pop returned the elements in LIFO order.\n");
+    lfstack_kill(s);
+}
+
+/**
+ * kill_test() - Test that lfstack_kill frees the remaining elements.
+ *
+ * Pushes malloc:ed elements with free as kill function. Run under
+ * valgrind or AddressSanitizer to detect leaks.
+ */
+void kill_test(void)
+{
+    fprintf(stderr, "Starting kill_test()...");
+
+    lfstack *s = lfstack_empty(free);
+
+    for (int i = 0; i < 10000; i++) {
+        int *v = malloc(sizeof(int));
+        *v = i;
+        lfstack_push(s, v);
+    }
+    // Popped elements are owned by the caller.
+    free(lfstack_pop(s));
+
+    lfstack_kill(s);
+    fprintf(stderr, "Test succeeded: lfstack_kill returned.\n");
+}
+
+/**
+ * capacity_test() - Test pushes on a full stack.
+ *
+ * Fills a stack with LFSTACK_CAPACITY elements. Further pushes must
+ * fail without changing the stack, and must keep failing, and a push
+ * after a pop must succeed again.
+ */
+void capacity_test(void)
+{
+    fprintf(stderr, "Starting capacity_test()...");
+
+    lfstack *s = lfstack_empty(NULL);
+    int v[2] = { 1, 2 };
+
+    for (long i = 0; i < LFSTACK_CAPACITY; i++) {
+        if (!lfstack_push(s, &v[0])) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: push %ld of %d failed.\n", i + 1, LFSTACK_CAPACITY);
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (int i = 0; i < 1000; i++) {
+        if (lfstack_push(s, &v[1])) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: push on a full stack succeeded.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (lfstack_pop(s) != &v[0] || !lfstack_push(s, &v[1]) || lfstack_pop(s) != &v[1]) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: the stack did not recover after a pop.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    lfstack_kill(s);
+    fprintf(stderr, "Test succeeded: pushes on a full stack failed.\n");
+}
+
+// Shared state for the stress test.
+typedef struct stress_arg {
+    lfstack *s;
+    int *elements; // The elements pushed by this thread
+    int *seen; // seen[v] counts how many times element v was popped
+    int popped; // Number of elements popped by this thread
+} stress_arg;
+
+// Thread function for the stress test. Pushes the elements of the
+// thread, popping one element after every second push.
+static void *stress_thread(void *p)
+{
+    stress_arg *a = p;
+
+    for (int i = 0; i < ELEMENTS_PER_THREAD; i++) {
+        lfstack_push(a->s, &a->elements[i]);
+        if (i % 2 == 1) {
+            int *v = lfstack_pop(a->s);
+            if (v != NULL) {
+                __atomic_fetch_add(&a->seen[*v], 1, __ATOMIC_RELAXED);
+                a->popped++;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * stress_test() - Test concurrent pushes and pops.
+ *
+ * THREADS threads push ELEMENTS_PER_THREAD unique elements each and
+ * pop concurrently. The remaining elements are popped at the end.
+ * Every element must be popped exactly once.
+ */
+void stress_test(void)
+{
+    fprintf(stderr, "Starting stress_test()...");
+
+    int total = THREADS * ELEMENTS_PER_THREAD;
+    int *values = malloc(total * sizeof(int));
+    int *seen = calloc(total, sizeof(int));
+    for (int i = 0; i < total; i++) {
+        values[i] = i;
+    }
+
+    lfstack *s = lfstack_empty(NULL);
+    pthread_t threads[THREADS];
+    stress_arg args[THREADS];
+
+    for (int t = 0; t < THREADS; t++) {
+        args[t] = (stress_arg) { s, values + t * ELEMENTS_PER_THREAD, seen, 0 };
+        pthread_create(&threads[t], NULL, stress_thread, &args[t]);
+    }
+    for (int t = 0; t < THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    // Drain the stack.
+    int *v;
+    while ((v = lfstack_pop(s)) != NULL) {
+        seen[*v]++;
+    }
+
+    for (int i = 0; i < total; i++) {
+        if (seen[i] != 1) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: element %d was popped %d times.\n", i, seen[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    fprintf(stderr, "Test succeeded: %d threads pushed and popped %d elements.\n",
+            THREADS, total);
+    lfstack_kill(s);
+    free(values);
+    free(seen);
+}
+
+int main(void)
+{
+    empty_test();       // Test lfstack_empty and lfstack_is_empty
+    push_pop_test();    // Test lfstack_push and lfstack_pop
+    kill_test();        // Test lfstack_kill
+    capacity_test();    // Test pushes on a full stack
+    stress_test();      // Test concurrent use
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
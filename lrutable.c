@@ -0,0 +1,933 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h> // For isspace()
+#include <stdarg.h>
+
+#include <table.h>
+
+#include "table_ext.h"
+
+// Initial number of buckets of the index. Must be a power of two.
+#define MIN_BUCKETS 16
+
+/*
+ * Implementation of a generic table for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The table keeps its entries in least recently used (LRU) order,
+ * with the same move-to-front rule as mtftable.c: lookups, inserts
+ * and updates move the key to the front. With table_set_capacity()
+ * from table_ext.h, the table is a cache that evicts from the back
+ * of the list when it grows over a number of entries or bytes.
+ *
+ * Each entry is a node of a doubly linked list in LRU order, so a
+ * found entry is moved to the front and the back entry is evicted in
+ * O(1). Tables created with table_empty_hashed() also link every
+ * entry into a chained hash index, so a search does not scan the
+ * list. The index doubles when it has more entries than buckets.
+ * Tables created with table_empty() search the list from the front,
+ * as mtftable.c.
+ *
+ * Inserting a key that is already in the table replaces its key and
+ * value, so the table holds no duplicates. table_choose_key() returns
+ * the least recently used key.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct entry {
+    void *key;
+    void *value;
+    size_t size; // Size charged to the byte limit
+    unsigned long hash;
+    struct entry *prev; // More recently used entry, or NULL
+    struct entry *next; // Less recently used entry, or NULL
+    struct entry *chain; // Next entry in the same bucket of the index
+} entry;
+
+struct table {
+    entry *front; // Most recently used entry
+    entry *back; // Least recently used entry
+    entry **buckets; // The hash index, or NULL without a hash function
+    int n_buckets; // Number of buckets, a power of two
+    int size; // Number of entries
+    size_t bytes; // Total size of the entries
+    int max_entries; // Maximum number of entries, or 0
+    size_t max_bytes; // Maximum total size, or 0
+    entry_size_function *size_func;
+    evict_function *evict_func;
+    void *evict_ctx;
+    compare_function *key_cmp_func;
+    hash_function *key_hash_func;
+    kill_function key_kill_func;
+    kill_function value_kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+// Internal function to return the bucket of a hash value.
+static entry **bucket(const table *t, unsigned long hash)
+{
+    return &t->buckets[hash & (t->n_buckets - 1)];
+}
+
+// Internal function to compute the size charged for an entry.
+static size_t entry_size(const table *t, const entry *e)
+{
+    return t->size_func != NULL ? t->size_func(e->key, e->value) : 0;
+}
+
+// Internal function to unlink an entry from the LRU list.
+static void list_unlink(table *t, entry *e)
+{
+    if (e->prev != NULL) {
+        e->prev->next = e->next;
+    } else {
+        t->front = e->next;
+    }
+    if (e->next != NULL) {
+        e->next->prev = e->prev;
+    } else {
+        t->back = e->prev;
+    }
+}
+
+// Internal function to link an entry first in the LRU list.
+static void list_push_front(table *t, entry *e)
+{
+    e->prev = NULL;
+    e->next = t->front;
+    if (t->front != NULL) {
+        t->front->prev = e;
+    } else {
+        t->back = e;
+    }
+    t->front = e;
+}
+
+/**
+ * find() - Find the entry of a key and make it the most recently used.
+ * @t: Table to search.
+ * @key: Key to search for.
+ * @hash: The hash value of the key, if the table has an index.
+ *
+ * Returns: The entry of the key, or NULL.
+ */
+static entry *find(table *t, const void *key, unsigned long hash)
+{
+    entry *e;
+
+    if (t->buckets != NULL) {
+        for (e = *bucket(t, hash); e != NULL; e = e->chain) {
+            if (e->hash == hash && t->key_cmp_func(e->key, key) == 0) {
+                break;
+            }
+        }
+    } else {
+        for (e = t->front; e != NULL; e = e->next) {
+            if (t->key_cmp_func(e->key, key) == 0) {
+                break;
+            }
+        }
+    }
+
+    if (e != NULL && e != t->front) {
+        list_unlink(t, e);
+        list_push_front(t, e);
+    }
+    return e;
+}
+
+// Internal function to compute the hash value needed by find().
+static unsigned long key_hash(const table *t, const void *key)
+{
+    return t->buckets != NULL ? t->key_hash_func(key) : 0;
+}
+
+// Internal function to double the number of buckets of the index.
+static void grow_index(table *t)
+{
+    int n_buckets = 2 * t->n_buckets;
+    entry **buckets = calloc(n_buckets, sizeof(entry *));
+
+    for (entry *e = t->front; e != NULL; e = e->next) {
+        entry **b = &buckets[e->hash & (n_buckets - 1)];
+        e->chain = *b;
+        *b = e;
+    }
+    free(t->buckets);
+    t->buckets = buckets;
+    t->n_buckets = n_buckets;
+}
+
+/**
+ * detach() - Remove an entry from the list and the index.
+ * @t: Table to manipulate.
+ * @e: The entry, which is not freed.
+ *
+ * Returns: Nothing.
+ */
+static void detach(table *t, entry *e)
+{
+    list_unlink(t, e);
+    if (t->buckets != NULL) {
+        entry **link = bucket(t, e->hash);
+        while (*link != e) {
+            link = &(*link)->chain;
+        }
+        *link = e->chain;
+    }
+    t->size--;
+    t->bytes -= e->size;
+}
+
+// Internal function to check if the table is over a limit.
+static bool over_limit(const table *t)
+{
+    return (t->max_entries > 0 && t->size > t->max_entries) ||
+        (t->max_bytes > 0 && t->bytes > t->max_bytes);
+}
+
+/**
+ * evict() - Evict least recently used entries until the table is within its limits.
+ * @t: Table to manipulate.
+ *
+ * The most recently used entry is never evicted.
+ *
+ * Returns: Nothing.
+ */
+static void evict(table *t)
+{
+    while (over_limit(t) && t->size > 1) {
+        entry *e = t->back;
+        detach(t, e);
+        if (t->evict_func != NULL) {
+            t->evict_func(e->key, e->value, t->evict_ctx);
+        } else {
+            if (t->key_kill_func != NULL) {
+                t->key_kill_func(e->key);
+            }
+            if (t->value_kill_func != NULL) {
+                t->value_kill_func(e->value);
+            }
+        }
+        free(e);
+    }
+}
+
+/**
+ * add_entry() - Add an entry for a key that is not in the table.
+ * @t: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ * @hash: The hash value of the key, if the table has an index.
+ *
+ * The entry becomes the most recently used one, and other entries are
+ * evicted if the table gets over a limit.
+ *
+ * Returns: Nothing.
+ */
+static void add_entry(table *t, void *key, void *value, unsigned long hash)
+{
+    entry *e = malloc(sizeof(entry));
+
+    e->key = key;
+    e->value = value;
+    e->hash = hash;
+    e->size = entry_size(t, e);
+    if (t->buckets != NULL) {
+        // Grow before the entry is in the list, which grow_index() indexes.
+        if (t->size >= t->n_buckets) {
+            grow_index(t);
+        }
+        entry **b = bucket(t, hash);
+        e->chain = *b;
+        *b = e;
+    }
+    list_push_front(t, e);
+    t->size++;
+    t->bytes += e->size;
+    evict(t);
+}
+
+// Internal function to charge an entry for a changed key or value.
+static void resize_entry(table *t, entry *e)
+{
+    t->bytes -= e->size;
+    e->size = entry_size(t, e);
+    t->bytes += e->size;
+    evict(t);
+}
+
+// ==========INTERFACE==========
+
+/**
+ * table_empty() - Create an empty table.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * The table has no hash index. Use table_empty_hashed() for one.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty(compare_function *key_cmp_func,
+                   kill_function key_kill_func,
+                   kill_function value_kill_func)
+{
+    return table_empty_hashed(key_cmp_func, NULL, key_kill_func, value_kill_func);
+}
+
+/**
+ * table_empty_hashed() - Create an empty table with a hash index.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function to be used to hash keys, or
+ *                 NULL for no index.
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_hashed(compare_function *key_cmp_func,
+                          hash_function *key_hash_func,
+                          kill_function key_kill_func,
+                          kill_function value_kill_func)
+{
+    table *t = calloc(1, sizeof(table));
+
+    if (key_hash_func != NULL) {
+        t->buckets = calloc(MIN_BUCKETS, sizeof(entry *));
+        t->n_buckets = MIN_BUCKETS;
+    }
+
+    // Store the key compare and hash functions and key/value kill functions.
+    t->key_cmp_func = key_cmp_func;
+    t->key_hash_func = key_hash_func;
+    t->key_kill_func = key_kill_func;
+    t->value_kill_func = value_kill_func;
+
+    return t;
+}
+
+/**
+ * table_set_capacity() - Bound the size of a table.
+ * @t: Table to manipulate.
+ * @max_entries: Maximum number of entries, or 0 for no limit.
+ * @max_bytes: Maximum total size of the entries, or 0 for no limit.
+ * @size_func: Function giving the size of an entry.
+ *
+ * See table_ext.h.
+ *
+ * Returns: Nothing.
+ */
+void table_set_capacity(table *t, int max_entries, size_t max_bytes,
+                        entry_size_function *size_func)
+{
+    t->max_entries = max_entries;
+    t->max_bytes = max_bytes;
+    if (size_func != t->size_func) {
+        // Charge the entries with the new function.
+        t->size_func = size_func;
+        t->bytes = 0;
+        for (entry *e = t->front; e != NULL; e = e->next) {
+            e->size = entry_size(t, e);
+            t->bytes += e->size;
+        }
+    }
+    evict(t);
+}
+
+/**
+ * table_set_evict() - Set the function called for evicted entries.
+ * @t: Table to manipulate.
+ * @evict_func: Function called for each evicted entry, or NULL.
+ * @ctx: Context pointer passed on to evict_func.
+ *
+ * See table_ext.h.
+ *
+ * Returns: Nothing.
+ */
+void table_set_evict(table *t, evict_function *evict_func, void *ctx)
+{
+    t->evict_func = evict_func;
+    t->evict_ctx = ctx;
+}
+
+/**
+ * table_is_empty() - Check if a table is empty.
+ * @table: Table to check.
+ *
+ * Returns: True if table contains no key/value pairs, false otherwise.
+ */
+bool table_is_empty(const table *t)
+{
+    return t->size == 0;
+}
+
+/**
+ * table_insert() - Add a key/value pair to a table.
+ * @table: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Insert the key/value pair into the table as the most recently used
+ * one. If the key is already in the table, its old key and value are
+ * de-allocated with the kill functions and replaced. Least recently
+ * used entries are evicted if the table gets over a limit.
+ *
+ * Returns: Nothing.
+ */
+void table_insert(table *t, void *key, void *value)
+{
+    unsigned long hash = key_hash(t, key);
+    entry *e = find(t, key, hash);
+
+    if (e == NULL) {
+        add_entry(t, key, value, hash);
+        return;
+    }
+
+    if (t->key_kill_func != NULL && e->key != key) {
+        t->key_kill_func(e->key);
+    }
+    if (t->value_kill_func != NULL && e->value != value) {
+        t->value_kill_func(e->value);
+    }
+    e->key = key;
+    e->value = value;
+    resize_entry(t, e);
+}
+
+/**
+ * table_lookup() - Look up a given key in a table.
+ * @table: Table to inspect.
+ * @key: Key to look up.
+ *
+ * A found key becomes the most recently used one.
+ *
+ * Returns: The value corresponding to a given key, or NULL if the key
+ * is not found in the table.
+ */
+void *table_lookup(const table *t, const void *key)
+{
+    entry *e = find((table *)t, key, key_hash(t, key));
+
+    return e != NULL ? e->value : NULL;
+}
+
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * See table_ext.h. The key becomes the most recently used one.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx)
+{
+    unsigned long hash = key_hash(t, key);
+    entry *e = find(t, key, hash);
+
+    if (e == NULL) {
+        void *value = fn(NULL, false, ctx);
+        if (value != NULL) {
+            add_entry(t, key, value, hash);
+        }
+        return value;
+    }
+
+    void *value = fn(e->value, true, ctx);
+    if (value != e->value && t->value_kill_func != NULL) {
+        t->value_kill_func(e->value);
+    }
+    e->value = value;
+    resize_entry(t, e);
+    return value;
+}
+
+/**
+ * table_choose_key() - Return an arbitrary key.
+ * @t: Table to inspect.
+ *
+ * Return the least recently used key in the table. Can be used
+ * together with table_remove() to deconstruct the table. Undefined
+ * for an empty table.
+ *
+ * Returns: The least recently used key.
+ */
+void *table_choose_key(const table *t)
+{
+    return t->back->key;
+}
+
+/**
+ * table_remove() - Remove a key/value pair in the table.
+ * @table: Table to manipulate.
+ * @key: Key for which to remove pair.
+ *
+ * Will call any kill functions set for keys/values. Does nothing if
+ * key is not found in the table.
+ *
+ * Returns: Nothing.
+ */
+void table_remove(table *t, const void *key)
+{
+    entry *e = find(t, key, key_hash(t, key));
+
+    if (e == NULL) {
+        return;
+    }
+    detach(t, e);
+    if (t->key_kill_func != NULL) {
+        t->key_kill_func(e->key);
+    }
+    if (t->value_kill_func != NULL) {
+        t->value_kill_func(e->value);
+    }
+    free(e);
+}
+
+/*
+ * table_kill() - Destroy a table.
+ * @table: Table to destroy.
+ *
+ * Return all dynamic memory used by the table and its elements. If a
+ * kill_func was registered for keys and/or values at table creation,
+ * it is called each element to kill any user-allocated memory
+ * occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void table_kill(table *t)
+{
+    entry *e = t->front;
+
+    while (e != NULL) {
+        entry *next = e->next;
+        if (t->key_kill_func != NULL) {
+            t->key_kill_func(e->key);
+        }
+        if (t->value_kill_func != NULL) {
+            t->value_kill_func(e->value);
+        }
+        free(e);
+        e = next;
+    }
+    free(t->buckets);
+    free(t);
+}
+
+/**
+ * table_print() - Print the given table.
+ * @t: Table to print.
+ * @print_func: Function called for each key/value pair in the table.
+ *
+ * Iterates over the key/value pairs in the table, from the most
+ * recently used one, and prints them.
+ *
+ * Returns: Nothing.
+ */
+void table_print(const table *t, inspect_callback_pair print_func)
+{
+    for (const entry *e = t->front; e != NULL; e = e->next) {
+        print_func(e->key, e->value);
+    }
+}
+
+// ===========INTERNAL FUNCTIONS USED BY table_print_internal ============
+
+// The functions below output code in the dot language, used by
+// GraphViz. For documention of the dot language, see graphviz.org.
+
+/**
+ * indent() - Output indentation string.
+ * @n: Indentation level.
+ *
+ * Print n tab characters.
+ *
+ * Returns: Nothing.
+ */
+static void indent(int n)
+{
+    for (int i=0; i<n; i++) {
+        printf("\t");
+    }
+}
+
+/**
+ * iprintf(...) - Indent and print.
+ * @n: Indentation level
+ * @...: printf arguments
+ *
+ * Print n tab characters and calls printf.
+ *
+ * Returns: Nothing.
+ */
+static void iprintf(int n, const char *fmt, ...)
+{
+    // Indent...
+    indent(n);
+    // ...and call printf
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * print_edge() - Print a edge between two addresses.
+ * @from: The address of the start of the edge. Should be non-NULL.
+ * @to: The address of the destination for the edge, including NULL.
+ * @port: The name of the port on the source node, or NULL.
+ * @label: The label for the edge, or NULL.
+ * @options: A string with other edge options, or NULL.
+ *
+ * Print an edge from port PORT on node FROM to TO with label
+ * LABEL. If to is NULL, the destination is the NULL node, otherwise a
+ * memory node. If the port is NULL, the edge starts at the node, not
+ * a specific port on it. If label is NULL, no label is used. The
+ * options string, if non-NULL, is printed before the label.
+ *
+ * Returns: Nothing.
+ */
+static void print_edge(int indent_level, const void *from, const void *to, const char *port,
+                       const char *label, const char *options)
+{
+    indent(indent_level);
+    if (port) {
+        printf("m%04lx:%s -> ", PTR2ADDR(from), port);
+    } else {
+        printf("m%04lx -> ", PTR2ADDR(from));
+    }
+    if (to == NULL) {
+        printf("NULL");
+    } else {
+        printf("m%04lx", PTR2ADDR(to));
+    }
+    printf(" [");
+    if (options != NULL) {
+        printf("%s", options);
+    }
+    if (label != NULL) {
+        printf(" label=\"%s\"",label);
+    }
+    printf("]\n");
+}
+
+/**
+ * print_head_node() - Print a node corresponding to the table struct.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ *
+ * Returns: Nothing.
+ */
+static void print_head_node(int indent_level, const table *t)
+{
+    iprintf(indent_level, "m%04lx [shape=record "
+            "label=\"front\\n%04lx|back\\n%04lx|buckets\\n%04lx|size\\n%d|bytes\\n%zu"
+            "|cmp\\n%04lx|hash\\n%04lx|key_kill\\n%04lx|value_kill\\n%04lx\"]\n",
+            PTR2ADDR(t), PTR2ADDR(t->front), PTR2ADDR(t->back), PTR2ADDR(t->buckets),
+            t->size, t->bytes, PTR2ADDR(t->key_cmp_func), PTR2ADDR(t->key_hash_func),
+            PTR2ADDR(t->key_kill_func), PTR2ADDR(t->value_kill_func));
+}
+
+// Internal function to print the key and value nodes in dot format.
+static void print_key_value_nodes(int indent_level, const void *key, const void *value,
+                                  inspect_callback key_print_func,
+                                  inspect_callback value_print_func)
+{
+    if (key != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(key));
+        if (key_print_func != NULL) {
+            key_print_func(key);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(key));
+    }
+    if (value != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(value));
+        if (value_print_func != NULL) {
+            value_print_func(value);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(value));
+    }
+}
+
+/**
+ * print_entry() - Print one entry in dot format.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ * @e: Address of the entry, used as the name of its node.
+ * @i: Position of the entry in the printout.
+ * @key: Key of the entry.
+ * @value: Value of the entry.
+ * @key_print_func: Function called for the key.
+ * @value_print_func: Function called for the value.
+ * @payload: If true, print the key and value nodes, otherwise the
+ *           entry node and its edges.
+ *
+ * The entry is drawn as an edge from the head node labelled with its
+ * position. Memory "owned" by the table is indicated by solid red
+ * lines. Memory "borrowed" from the user is indicated by red dashed
+ * lines.
+ *
+ * Returns: Nothing.
+ */
+static void print_entry(int indent_level, const table *t, const void *e, int i,
+                        const void *key, const void *value,
+                        inspect_callback key_print_func,
+                        inspect_callback value_print_func, bool payload)
+{
+    if (payload) {
+        print_key_value_nodes(indent_level, key, value, key_print_func, value_print_func);
+        return;
+    }
+    char label[16];
+    snprintf(label, sizeof(label), "%d", i);
+
+    iprintf(indent_level, "m%04lx [shape=record label=\"<k>key\\n%04lx|<v>value\\n%04lx\"]\n",
+            PTR2ADDR(e), PTR2ADDR(key), PTR2ADDR(value));
+    print_edge(indent_level, t, e, NULL, label, NULL);
+    if (key == NULL) {
+        print_edge(indent_level, e, key, "k", "key", NULL);
+    } else if (t->key_kill_func) {
+        print_edge(indent_level, e, key, "k", "key", "color=red");
+    } else {
+        print_edge(indent_level, e, key, "k", "key", "color=red style=dashed");
+    }
+    if (value == NULL) {
+        print_edge(indent_level, e, value, "v", "value", NULL);
+    } else if (t->value_kill_func) {
+        print_edge(indent_level, e, value, "v", "value", "color=red");
+    } else {
+        print_edge(indent_level, e, value, "v", "value", "color=red style=dashed");
+    }
+}
+
+// Internal function to print the entries from the most to the least
+// recently used in dot format.
+static void print_entries(int indent_level, const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, bool payload)
+{
+    int i = 0;
+
+    for (const entry *e = t->front; e != NULL; e = e->next) {
+        print_entry(indent_level, t, e, i++, e->key, e->value,
+                    key_print_func, value_print_func, payload);
+    }
+}
+
+// Create an escaped version of the input string. The most common
+// control characters - newline, horizontal tab, backslash, and double
+// quote - are replaced by their escape sequence. The returned pointer
+// must be deallocated by the caller.
+static char *escape_chars(const char *s)
+{
+    int i, j;
+    int escaped = 0; // The number of chars that must be escaped.
+
+    // Count how many chars need to be escaped, i.e. how much longer
+    // the output string will be.
+    for (i = escaped = 0; s[i] != '\0'; i++) {
+        if (s[i] == '\n' || s[i] == '\t' || s[i] == '\\' || s[i] == '\"') {
+            escaped++;
+        }
+    }
+    // Allocate space for the escaped string. The variable i holds the input
+    // length, escaped how much the string will grow.
+    char *t = malloc(i + escaped + 1);
+
+    // Copy-and-escape loop
+    for (i = j = 0; s[i] != '\0'; i++) {
+        // Convert each control character by its escape sequence.
+        // Non-control characters are copied as-is.
+        switch (s[i]) {
+        case '\n': t[i+j] = '\\'; t[i+j+1] = 'n';  j++; break;
+        case '\t': t[i+j] = '\\'; t[i+j+1] = 't';  j++; break;
+        case '\\': t[i+j] = '\\'; t[i+j+1] = '\\'; j++; break;
+        case '\"': t[i+j] = '\\'; t[i+j+1] = '\"'; j++; break;
+        default:   t[i+j] = s[i]; break;
+        }
+    }
+    // Terminal the output string
+    t[i+j] = '\0';
+    return t;
+}
+
+/**
+ * first_white_spc() - Return pointer to first white-space char.
+ * @s: String.
+ *
+ * Returns: A pointer to the first white-space char in s, or NULL if none is found.
+ *
+ */
+static const char *find_white_spc(const char *s)
+{
+    const char *t = s;
+    while (*t != '\0') {
+        if (isspace(*t)) {
+            // We found a white-space char, return a point to it.
+            return t;
+        }
+        // Advance to next char
+        t++;
+    }
+    // No white-space found
+    return NULL;
+}
+
+/**
+ * insert_table_name() - Maybe insert the name of the table src file in the description string.
+ * @s: Description string.
+ *
+ * Parses the description string to find of if it starts with a c file
+ * name. In that case, the file name of this file is spliced into the
+ * description string. The parsing is not very intelligent: If the
+ * sequence ".c:" (case insensitive) is found before the first
+ * white-space, the string up to and including ".c" is taken to be a c
+ * file name.
+ *
+ * Returns: A dynamic copy of s, optionally including with the table src file name.
+ */
+static char *insert_table_name(const char *s)
+{
+    // First, determine if the description string starts with a c file name
+    // a) Search for the string ".c:"
+    const char *dot_c = strstr(s, ".c:");
+    // b) Search for the first white-space
+    const char *spc = find_white_spc(s);
+
+    bool prefix_found;
+    int output_length;
+
+    // If both a) and b) are found AND a) is before b, we assume that
+    // s starts with a file name
+    if (dot_c != NULL && spc != NULL && dot_c < spc) {
+        // We found a match. Output string is input + 3 chars + __FILE__
+        prefix_found = true;
+        output_length = strlen(s) + 3 + strlen(__FILE__);
+    } else {
+        // No match found. Output string is just input
+        prefix_found = false;
+        output_length = strlen(s);
+    }
+
+    // Allocate space for the whole string
+    char *out = calloc(1, output_length + 1);
+    strcpy(out, s);
+    if (prefix_found) {
+        // Overwrite the output buffer from the ":"
+        strcpy(out + (dot_c - s + 2), " (");
+        // Now out will be 0-terminated after "(", append the file name and ")"
+        strcat(out, __FILE__);
+        strcat(out, ")");
+        // Finally append the input string from the : onwards
+        strcat(out, dot_c + 2);
+    }
+    return out;
+}
+
+/**
+ * table_print_internal() - Output the internal structure of the table.
+ * @t: Table to print.
+ * @key_print_func: Function called for each key in the table.
+ * @value_print_func: Function called for each value in the table.
+ * @desc: String with a description/state of the list.
+ * @indent_level: Indentation level, 0 for outermost
+ *
+ * Prints code that shows the entries from the most to the least
+ * recently used, each as an edge from the table struct labelled with
+ * its position. The hash index is not shown. Unlike table_lookup(),
+ * the function does not change the order of use.
+ *
+ * Returns: Nothing.
+ */
+void table_print_internal(const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, const char *desc,
+                          int indent_level)
+{
+    static int graph_number = 0;
+    graph_number++;
+    int il = indent_level;
+
+    if (indent_level == 0) {
+        // If this is the outermost datatype, start a graph and set up defaults
+        printf("digraph TABLE_%d {\n", graph_number);
+
+        // Specify default shape and fontname
+        il++;
+        iprintf(il, "node [shape=rectangle fontname=\"Courier New\"]\n");
+        iprintf(il, "ranksep=0.01\n");
+        iprintf(il, "subgraph cluster_nullspace {\n");
+        iprintf(il+1, "NULL\n");
+        iprintf(il, "}\n");
+    }
+
+    if (desc != NULL) {
+        // Escape the string before printout
+        char *escaped = escape_chars(desc);
+        // Optionally, splice the source file name
+        char *spliced = insert_table_name(escaped);
+
+        // Use different names on inner description nodes
+        if (indent_level == 0) {
+            iprintf(il, "description [label=\"%s\"]\n", spliced);
+        } else {
+            iprintf(il, "\tcluster_list_%d_description [label=\"%s\"]\n", graph_number, spliced);
+        }
+        // Return the memory used by the spliced and escaped strings
+        free(spliced);
+        free(escaped);
+    }
+
+    if (indent_level == 0) {
+        // Use a single "pointer" edge as a starting point for the
+        // outermost datatype
+        iprintf(il, "t [label=\"%04lx\" xlabel=\"t\"]\n", PTR2ADDR(t));
+        iprintf(il, "t -> m%04lx\n", PTR2ADDR(t));
+    }
+
+    if (indent_level == 0) {
+        // Put the user nodes in userspace
+        iprintf(il, "subgraph cluster_userspace { label=\"User space\"\n");
+        il++;
+
+        // Print the key and value nodes
+        print_entries(il, t, key_print_func, value_print_func, true);
+
+        // Close the subgraph
+        il--;
+        iprintf(il, "}\n");
+    }
+
+    // Print the subgraph to surround the table content
+    iprintf(il, "subgraph cluster_table_%d { label=\"Table\"\n", graph_number);
+    il++;
+
+    // Output the head node
+    print_head_node(il, t);
+
+    // Output the entries and their edges
+    print_entries(il, t, key_print_func, value_print_func, false);
+
+    // Close the subgraph
+    il--;
+    iprintf(il, "}\n");
+
+    if (indent_level == 0) {
+        // Termination of graph
+        printf("}\n");
+    }
+}
@@ -0,0 +1,249 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "table_ext.h"
+#include "int_fixture.h"
+
+/**
+ * lrutable_test.c - Tests for the LRU cache of lrutable.c.
+ *
+ * This file contains tests of eviction by number of entries and by
+ * bytes, of the evict and kill functions, and of the hash index. The
+ * plain table.h operations are covered by table_difftest.c. Each test
+ * terminates the program with an error message if it fails.
+ *
+ * Compile with: gcc -I<include> lrutable_test.c lrutable.c table_ext.c int_fixture.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Use the helpers of int_fixture.c.
+ */
+
+// Number of keys and operations of model_test().
+#define KEYS 200
+#define OPS 20000
+
+// Number of calls to count_compares().
+static long compares = 0;
+
+// Internal function to compare the int keys with compare_int() and
+// count the calls.
+static int count_compares(const void *a, const void *b)
+{
+    compares++;
+    return compare_int(a, b);
+}
+
+// Size function that charges the value of an entry as its size.
+static size_t value_size(const void *key, const void *value)
+{
+    (void)key;
+    return *(const int *)value;
+}
+
+// State of the reference model of model_test().
+typedef struct model {
+    long stamp[KEYS]; // Time the key was last used, 0 if absent
+    long now;
+    int size;
+    int evicted; // Number of evict calls
+} model;
+
+// Internal function to return the least recently used key of the model.
+static int model_lru(const model *m)
+{
+    int lru = -1;
+
+    for (int k = 0; k < KEYS; k++) {
+        if (m->stamp[k] > 0 && (lru < 0 || m->stamp[k] < m->stamp[lru])) {
+            lru = k;
+        }
+    }
+    return lru;
+}
+
+// Evict function that checks the evicted key against the model and
+// frees the key and value.
+static void check_evict(void *key, void *value, void *ctx)
+{
+    model *m = ctx;
+    int k = *(int *)key;
+    int lru = model_lru(m);
+
+    if (k != lru || *(int *)value != k) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: evicted key %d with value %d, the least recently used is %d.\n",
+                k, *(int *)value, lru);
+        exit(EXIT_FAILURE);
+    }
+    m->stamp[k] = 0;
+    m->size--;
+    m->evicted++;
+    kill_int(key);
+    kill_int(value);
+}
+
+/**
+ * model_test() - Compare a cache with a reference model.
+ * @hash: Hash function of the table, or NULL.
+ * @capacity: Maximum number of entries.
+ *
+ * Random lookups, inserts and removes are run on a cache and on a
+ * model that keeps the time of the last use of each key. Every
+ * lookup and every evicted key must agree with the model.
+ */
+void model_test(hash_function *hash, int capacity)
+{
+    fprintf(stderr, "Starting model_test()...");
+
+    table *t = table_empty_hashed(count_compares, hash, kill_int, kill_int);
+    model m = { .now = 0 };
+    unsigned state = 7;
+
+    table_set_capacity(t, capacity, 0, NULL);
+    table_set_evict(t, check_evict, &m);
+    ints_allocated = 0;
+    ints_killed = 0;
+
+    for (int i = 0; i < OPS; i++) {
+        unsigned r = next_random(&state);
+        int k = r / 3 % KEYS;
+
+        switch (r % 3) {
+        case 0: {
+            int *v = table_lookup(t, &k);
+            if ((m.stamp[k] > 0) != (v != NULL) || (v != NULL && *v != k)) {
+                // Fail with error message
+                fprintf(stderr, "FAIL: lookup of %d returned %d.\n", k, v == NULL ? -1 : *v);
+                exit(EXIT_FAILURE);
+            }
+            if (v != NULL) {
+                m.stamp[k] = ++m.now;
+            }
+            break;
+        }
+        case 1:
+            // The model is updated first, since check_evict() is
+            // called during the insert.
+            m.size += m.stamp[k] == 0;
+            m.stamp[k] = ++m.now;
+            table_insert(t, new_int(k), new_int(k));
+            break;
+        default:
+            m.size -= m.stamp[k] > 0;
+            m.stamp[k] = 0;
+            table_remove(t, &k);
+            break;
+        }
+    }
+
+    if (m.evicted == 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: no entry was evicted.\n");
+        exit(EXIT_FAILURE);
+    }
+    table_kill(t);
+    check_ints_killed();
+
+    fprintf(stderr, "Test succeeded: %d evictions agreed with the model.\n", m.evicted);
+}
+
+/**
+ * bytes_test() - Test eviction by bytes with the kill functions.
+ *
+ * The values are the sizes of the entries. Without an evict function,
+ * evicted keys and values must be killed.
+ */
+void bytes_test(void)
+{
+    fprintf(stderr, "Starting bytes_test()...");
+
+    table *t = table_empty_hashed(count_compares, hash_int, kill_int, kill_int);
+    ints_allocated = 0;
+    ints_killed = 0;
+
+    table_set_capacity(t, 0, 100, value_size);
+    for (int k = 1; k <= 10; k++) {
+        table_insert(t, new_int(k), new_int(k)); // 55 bytes in all
+    }
+    int k = 1;
+    table_lookup(t, &k); // Key 1 is now the most recently used
+    table_insert(t, new_int(50), new_int(50)); // 105 bytes: evicts 2 and 3
+
+    int gone[] = { 2, 3 };
+    for (int i = 0; i < 2; i++) {
+        if (table_lookup(t, &gone[i]) != NULL) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: key %d was not evicted.\n", gone[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (table_lookup(t, &k) == NULL || ints_killed != 4) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: key 1 was evicted or %ld keys and values killed, expected 4.\n",
+                ints_killed);
+        exit(EXIT_FAILURE);
+    }
+
+    // An entry larger than the budget is kept alone.
+    table_insert(t, new_int(200), new_int(200));
+    k = 200;
+    if (table_lookup(t, &k) == NULL || (table_remove(t, &k), !table_is_empty(t))) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: an entry larger than the budget was not kept alone.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    check_ints_killed();
+
+    fprintf(stderr, "Test succeeded: the byte budget was kept.\n");
+}
+
+/**
+ * index_test() - Test that hits do not scan the list.
+ *
+ * In a table with a hash index, looking up the least recently used
+ * key of a large table must only compare a few keys.
+ */
+void index_test(void)
+{
+    fprintf(stderr, "Starting index_test()...");
+
+    table *t = table_empty_hashed(count_compares, hash_int, NULL, NULL);
+    int keys[1000];
+
+    for (int k = 0; k < 1000; k++) {
+        keys[k] = k;
+        table_insert(t, &keys[k], &keys[k]);
+    }
+    compares = 0;
+    for (int k = 0; k < 1000; k++) {
+        // Key k is the least recently used one.
+        if (*(int *)table_choose_key(t) != k || table_lookup(t, &keys[k]) != &keys[k]) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: key %d was not the least recently used one.\n", k);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (compares > 2000) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: 1000 lookups compared %ld keys.\n", compares);
+        exit(EXIT_FAILURE);
+    }
+    table_kill(t);
+
+    fprintf(stderr, "Test succeeded: 1000 lookups compared %ld keys.\n", compares);
+}
+
+int main(void)
+{
+    model_test(hash_int, 50);  // Test eviction with the index
+    model_test(NULL, 50);      // Test eviction without the index
+    model_test(hash_int, 1);   // Test a cache of one entry
+    bytes_test();              // Test the byte budget
+    index_test();              // Test the cost of hits
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
@@ -0,0 +1,249 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "perf_counters.h"
+
+/*
+ * Hardware performance counters, see perf_counters.h.
+ *
+ * Each event is opened as its own counter rather than as one group,
+ * so that an event the CPU does not support only makes that counter
+ * unavailable. The counters are enabled and disabled one after the
+ * other, so each includes a few instructions of the others' ioctl
+ * calls, which is negligible for measurements of many operations.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+struct perf_counters {
+    int fd[PERF_NUM_COUNTERS]; // File descriptor of each counter, or -1
+};
+
+static const char *counter_names[PERF_NUM_COUNTERS] = {
+    "cycles", "instructions", "l1d-miss", "llc-miss", "dtlb-miss", "branch-miss"
+};
+
+#ifdef __linux__
+
+// The perf event type and config of each counter.
+static const struct {
+    unsigned type;
+    unsigned long long config;
+} events[PERF_NUM_COUNTERS] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8
+                          | PERF_COUNT_HW_CACHE_RESULT_MISS << 16 },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | PERF_COUNT_HW_CACHE_OP_READ << 8
+                          | PERF_COUNT_HW_CACHE_RESULT_MISS << 16 },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * open_event() - Open one counter for the calling thread.
+ * @c: Counter to open.
+ *
+ * The counter starts disabled and counts user-space events only,
+ * which is allowed at the default perf_event_paranoid level.
+ *
+ * Returns: The file descriptor, or -1 if the counter is unavailable.
+ */
+static int open_event(perf_counter c)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = events[c].type;
+    attr.config = events[c].config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/**
+ * read_event() - Read a counter, scaled for multiplexing.
+ * @fd: File descriptor of the counter.
+ *
+ * Returns: The estimated count, or -1 if the counter could not be read
+ *          or never ran.
+ */
+static long long read_event(int fd)
+{
+    // Value, time enabled and time running.
+    unsigned long long data[3];
+
+    if (read(fd, data, sizeof(data)) != (ssize_t)sizeof(data) || data[2] == 0) {
+        return -1;
+    }
+    if (data[2] < data[1]) {
+        return (long long)((double)data[0] * data[1] / data[2]);
+    }
+    return (long long)data[0];
+}
+
+#endif
+
+// ==========INTERFACE==========
+
+/**
+ * perf_counters_open() - Open all counters for the calling thread.
+ *
+ * Returns: A pointer to the new counter set. Never NULL; counters
+ * that could not be opened are unavailable.
+ */
+perf_counters *perf_counters_open(void)
+{
+    perf_counters *pc = malloc(sizeof(*pc));
+
+    for (int c = 0; c < PERF_NUM_COUNTERS; c++) {
+#ifdef __linux__
+        pc->fd[c] = open_event(c);
+#else
+        pc->fd[c] = -1;
+#endif
+    }
+    return pc;
+}
+
+/**
+ * perf_counters_available() - Count the available counters.
+ * @pc: Counter set.
+ *
+ * Returns: The number of counters that could be opened.
+ */
+int perf_counters_available(const perf_counters *pc)
+{
+    int n = 0;
+
+    for (int c = 0; c < PERF_NUM_COUNTERS; c++) {
+        n += pc->fd[c] >= 0;
+    }
+    return n;
+}
+
+/**
+ * perf_counters_start() - Reset the counters and start counting.
+ * @pc: Counter set.
+ *
+ * Returns: Nothing.
+ */
+void perf_counters_start(perf_counters *pc)
+{
+#ifdef __linux__
+    for (int c = 0; c < PERF_NUM_COUNTERS; c++) {
+        if (pc->fd[c] >= 0) {
+            ioctl(pc->fd[c], PERF_EVENT_IOC_RESET, 0);
+            ioctl(pc->fd[c], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#else
+    (void)pc;
+#endif
+}
+
+/**
+ * perf_counters_stop() - Stop counting and read the counters.
+ * @pc: Counter set.
+ * @values: Set to the count of each event since perf_counters_start(),
+ *          or -1 for unavailable counters.
+ *
+ * Returns: Nothing.
+ */
+void perf_counters_stop(perf_counters *pc, long long values[PERF_NUM_COUNTERS])
+{
+    for (int c = 0; c < PERF_NUM_COUNTERS; c++) {
+        values[c] = -1;
+#ifdef __linux__
+        if (pc->fd[c] >= 0) {
+            ioctl(pc->fd[c], PERF_EVENT_IOC_DISABLE, 0);
+        }
+#endif
+    }
+#ifdef __linux__
+    for (int c = 0; c < PERF_NUM_COUNTERS; c++) {
+        if (pc->fd[c] >= 0) {
+            values[c] = read_event(pc->fd[c]);
+        }
+    }
+#endif
+}
+
+/**
+ * perf_counter_name() - Return the short name of a counter.
+ * @c: Counter.
+ *
+ * Returns: A name such as "cycles" or "llc-miss".
+ */
+const char *perf_counter_name(perf_counter c)
+{
+    return counter_names[c];
+}
+
+/**
+ * perf_counters_format() - Format counter values per operation.
+ * @values: Values from perf_counters_stop().
+ * @ops: Number of operations measured.
+ * @buf: Buffer for the text.
+ * @size: Size of the buffer.
+ *
+ * Returns: buf.
+ */
+char *perf_counters_format(const long long values[PERF_NUM_COUNTERS], long ops, char *buf,
+                           size_t size)
+{
+    size_t len = 0;
+
+    buf[0] = '\0';
+    for (int c = 0; c < PERF_NUM_COUNTERS && len < size; c++) {
+        if (values[c] >= 0) {
+            len += snprintf(buf + len, size - len, "%s%s=%.2f", len > 0 ? " " : "",
+                            counter_names[c], (double)values[c] / ops);
+        }
+    }
+    if (len == 0) {
+        snprintf(buf, size, "counters=n/a");
+    } else if (len < size && values[PERF_COUNTER_CYCLES] > 0
+               && values[PERF_COUNTER_INSTRUCTIONS] >= 0) {
+        snprintf(buf + len, size - len, " ipc=%.2f",
+                 (double)values[PERF_COUNTER_INSTRUCTIONS] / values[PERF_COUNTER_CYCLES]);
+    }
+    return buf;
+}
+
+/**
+ * perf_counters_close() - Close all counters.
+ * @pc: Counter set to close.
+ *
+ * Returns: Nothing.
+ */
+void perf_counters_close(perf_counters *pc)
+{
+#ifdef __linux__
+    for (int c = 0; c < PERF_NUM_COUNTERS; c++) {
+        if (pc->fd[c] >= 0) {
+            close(pc->fd[c]);
+        }
+    }
+#endif
+    free(pc);
+}
@@ -0,0 +1,107 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stddef.h>
+
+/*
+ * Hardware performance counters for the benchmarks.
+ *
+ * On Linux the counters are read with perf_event_open(2). They count
+ * user-space events of the calling thread only, so threads started by
+ * the measured code are not included. Counters the kernel or the CPU
+ * does not offer, e.g. in a container or a virtual machine, are
+ * unavailable and read as -1; if none is available the benchmarks
+ * report time only. On other systems no counter is available.
+ *
+ * When more counters are requested than the CPU has, the kernel
+ * multiplexes them and the values are scaled to the full measurement
+ * time, so they are estimates.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// The counted events.
+typedef enum perf_counter {
+    PERF_COUNTER_CYCLES,
+    PERF_COUNTER_INSTRUCTIONS,
+    PERF_COUNTER_L1D_MISSES, // L1 data cache read misses
+    PERF_COUNTER_LLC_MISSES, // Last level cache misses
+    PERF_COUNTER_DTLB_MISSES, // Data TLB read misses
+    PERF_COUNTER_BRANCH_MISSES,
+    PERF_NUM_COUNTERS
+} perf_counter;
+
+typedef struct perf_counters perf_counters;
+
+// ==========INTERFACE==========
+
+/**
+ * perf_counters_open() - Open all counters for the calling thread.
+ *
+ * Returns: A pointer to the new counter set. Never NULL; counters
+ * that could not be opened are unavailable.
+ */
+perf_counters *perf_counters_open(void);
+
+/**
+ * perf_counters_available() - Count the available counters.
+ * @pc: Counter set.
+ *
+ * Returns: The number of counters that could be opened.
+ */
+int perf_counters_available(const perf_counters *pc);
+
+/**
+ * perf_counters_start() - Reset the counters and start counting.
+ * @pc: Counter set.
+ *
+ * Returns: Nothing.
+ */
+void perf_counters_start(perf_counters *pc);
+
+/**
+ * perf_counters_stop() - Stop counting and read the counters.
+ * @pc: Counter set.
+ * @values: Set to the count of each event since perf_counters_start(),
+ *          or -1 for unavailable counters.
+ *
+ * Returns: Nothing.
+ */
+void perf_counters_stop(perf_counters *pc, long long values[PERF_NUM_COUNTERS]);
+
+/**
+ * perf_counter_name() - Return the short name of a counter.
+ * @c: Counter.
+ *
+ * Returns: A name such as "cycles" or "llc-miss".
+ */
+const char *perf_counter_name(perf_counter c);
+
+/**
+ * perf_counters_format() - Format counter values per operation.
+ * @values: Values from perf_counters_stop().
+ * @ops: Number of operations measured.
+ * @buf: Buffer for the text.
+ * @size: Size of the buffer.
+ *
+ * Writes e.g. "cycles=12.3 instructions=30.1 ... ipc=2.45" with the
+ * available counters divided by ops, or "counters=n/a" if none is
+ * available.
+ *
+ * Returns: buf.
+ */
+char *perf_counters_format(const long long values[PERF_NUM_COUNTERS], long ops, char *buf,
+                           size_t size);
+
+/**
+ * perf_counters_close() - Close all counters.
+ * @pc: Counter set to close.
+ *
+ * Returns: Nothing.
+ */
+void perf_counters_close(perf_counters *pc);
+
+#endif
@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "pstack.h"
+
+/*
+ * Implementation of a persistent generic stack for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * The elements are stored in immutable singly linked nodes. A version
+ * is a small header pointing to its top node, and a push allocates a
+ * node whose below pointer is the old top. Each node counts the
+ * headers and nodes that point to it. Killing a version decrements
+ * the count of its top node; a node whose count drops to zero is
+ * freed, and the walk continues with the node below it. The walk
+ * stops at the first node that is still shared, so killing a version
+ * only costs time for the nodes it owned alone.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct node {
+    struct node *below; // The node below this one, or NULL
+    void *value;
+    int refs; // Number of versions and nodes pointing to this node
+} node;
+
+struct pstack {
+    node *top; // Top node, or NULL if empty
+    kill_function kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * version() - Create a version header.
+ * @top: Top node. The caller has already counted the reference.
+ * @kill_func: Kill function shared by the versions.
+ *
+ * Returns: A pointer to the new version.
+ */
+static pstack *version(node *top, kill_function kill_func)
+{
+    pstack *s = malloc(sizeof(*s));
+    s->top = top;
+    s->kill_func = kill_func;
+
+    return s;
+}
+
+/**
+ * pstack_empty() - Create an empty stack.
+ * @kill_func: A pointer to a function (or NULL) to be called to
+ *             de-allocate memory for elements that are no longer
+ *             contained in any version.
+ *
+ * Returns: A pointer to the new stack.
+ */
+pstack *pstack_empty(kill_function kill_func)
+{
+    return version(NULL, kill_func);
+}
+
+/**
+ * pstack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool pstack_is_empty(const pstack *s)
+{
+    return s->top == NULL;
+}
+
+/**
+ * pstack_push() - Push a value on top of a stack.
+ * @s: Stack to push on. Not modified.
+ * @v: Value (pointer) to be put on the stack.
+ *
+ * Returns: A new version with v on top of the elements of s.
+ */
+pstack *pstack_push(const pstack *s, void *v)
+{
+    node *n = malloc(sizeof(*n));
+    n->below = s->top;
+    n->value = v;
+    n->refs = 1;
+    if (n->below != NULL) {
+        n->below->refs++;
+    }
+
+    return version(n, s->kill_func);
+}
+
+/**
+ * pstack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to pop from. Not modified.
+ *
+ * NOTE: Undefined for an empty stack.
+ *
+ * Returns: A new version with the elements of s except the top.
+ */
+pstack *pstack_pop(const pstack *s)
+{
+    if (pstack_is_empty(s)) {
+        fprintf(stderr, "pstack_pop: Warning: pop on empty stack\n");
+        return pstack_clone(s);
+    }
+
+    node *below = s->top->below;
+    if (below != NULL) {
+        below->refs++;
+    }
+
+    return version(below, s->kill_func);
+}
+
+/**
+ * pstack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack.
+ *          NOTE: The return value is undefined for an empty stack.
+ */
+void *pstack_top(const pstack *s)
+{
+    if (pstack_is_empty(s)) {
+        fprintf(stderr, "pstack_top: Warning: top on empty stack\n");
+        return NULL;
+    }
+    return s->top->value;
+}
+
+/**
+ * pstack_clone() - Create another handle to a version.
+ * @s: Stack to clone.
+ *
+ * Returns: A new version with the same elements as s.
+ */
+pstack *pstack_clone(const pstack *s)
+{
+    if (s->top != NULL) {
+        s->top->refs++;
+    }
+
+    return version(s->top, s->kill_func);
+}
+
+/**
+ * pstack_kill() - Release a version of a stack.
+ * @s: Stack to release.
+ *
+ * Returns: Nothing.
+ */
+void pstack_kill(pstack *s)
+{
+    node *n = s->top;
+
+    // Iterate rather than recurse, since a deep stack may be released
+    // in one go.
+    while (n != NULL && --n->refs == 0) {
+        node *below = n->below;
+        if (s->kill_func != NULL) {
+            s->kill_func(n->value);
+        }
+        free(n);
+        n = below;
+    }
+    free(s);
+}
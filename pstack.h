@@ -0,0 +1,115 @@
+#ifndef __PSTACK_H
+#define __PSTACK_H
+
+#include <stdbool.h>
+
+#include <util.h>
+
+/*
+ * Declaration of a persistent generic stack for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * A pstack is one version of a stack. pstack_push() and pstack_pop()
+ * never modify their argument; they return a new version that shares
+ * all nodes below the top with the old one. pstack_clone() returns
+ * another handle to the same version in O(1). Every version must be
+ * released with pstack_kill(), and each element is passed to the kill
+ * function once no live version contains it anymore.
+ *
+ * An element pointer should only be pushed once; pushing the same
+ * pointer twice, even on different versions, makes the kill function
+ * see it twice.
+ *
+ * The nodes are reference counted without locks, so the versions of a
+ * stack must not be used concurrently from several threads.
+ *
+ * Example, a branch point in a backtracking search:
+ *   pstack *child = pstack_push(s, move);
+ *   search(child);
+ *   pstack_kill(child); // s is unchanged
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+typedef struct pstack pstack;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * pstack_empty() - Create an empty stack.
+ * @kill_func: A pointer to a function (or NULL) to be called to
+ *             de-allocate memory for elements that are no longer
+ *             contained in any version.
+ *
+ * All versions derived from the new stack share the kill function.
+ *
+ * Returns: A pointer to the new stack.
+ */
+pstack *pstack_empty(kill_function kill_func);
+
+/**
+ * pstack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool pstack_is_empty(const pstack *s);
+
+/**
+ * pstack_push() - Push a value on top of a stack.
+ * @s: Stack to push on. Not modified.
+ * @v: Value (pointer) to be put on the stack.
+ *
+ * Returns: A new version with v on top of the elements of s.
+ */
+pstack *pstack_push(const pstack *s, void *v);
+
+/**
+ * pstack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to pop from. Not modified.
+ *
+ * The removed element stays in s, so the kill function is not called
+ * until s is also killed.
+ *
+ * NOTE: Undefined for an empty stack.
+ *
+ * Returns: A new version with the elements of s except the top.
+ */
+pstack *pstack_pop(const pstack *s);
+
+/**
+ * pstack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack.
+ *          NOTE: The return value is undefined for an empty stack.
+ */
+void *pstack_top(const pstack *s);
+
+/**
+ * pstack_clone() - Create another handle to a version.
+ * @s: Stack to clone.
+ *
+ * Takes O(1) time regardless of the number of elements.
+ *
+ * Returns: A new version with the same elements as s.
+ */
+pstack *pstack_clone(const pstack *s);
+
+/**
+ * pstack_kill() - Release a version of a stack.
+ * @s: Stack to release.
+ *
+ * Return the memory of the version and of all nodes that no other
+ * version shares. If a kill_func was registered at stack creation, it
+ * is called for the elements of those nodes.
+ *
+ * Returns: Nothing.
+ */
+void pstack_kill(pstack *s);
+
+#endif
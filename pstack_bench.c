@@ -0,0 +1,175 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+#include "bench_clock.h"
+#include "stack.h"
+#include "pstack.h"
+
+/**
+ * pstack_bench.c - Compare the persistent stack with copy-on-branch.
+ *
+ * Compile with an implementation of stack.h, e.g.:
+ *
+ *   gcc -O2 -I<include> pstack_bench.c pstack.c chunkstack.c arena.c bench_clock.c
+ *
+ * Usage: pstack_bench [depth] [branching] [prefill]
+ *
+ * Simulates a backtracking search: a depth-first walk of a tree with
+ * the given depth (default 10) and branching factor (default 3). The
+ * search state is a stack that starts with prefill elements (default
+ * 1000), and each step down the tree pushes one element. At every
+ * branch point the state is snapshotted:
+ *  - copy:       with stack.h, by copying all elements to a new stack,
+ *  - persistent: with pstack.h, by pushing on the shared version.
+ * For each strategy the total time and the peak heap usage during the
+ * search (from mallinfo2(), glibc only) are printed.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Clock helpers moved to bench_clock.c.
+ */
+
+// The element pushed on the stacks. Elements are not owned by the
+// stacks, so only the stacks themselves are measured.
+static int value;
+
+// Search parameters.
+static int depth = 10;
+static int branching = 3;
+static int prefill = 1000;
+
+// Heap usage before the search and the peak during the search.
+static size_t base_heap;
+static size_t peak_heap;
+
+// Internal function to sample the heap usage at a leaf of the search.
+static void sample_heap(void)
+{
+    size_t used = mallinfo2().uordblks;
+    if (used > peak_heap) {
+        peak_heap = used;
+    }
+}
+
+/**
+ * copy_stack() - Copy a stack with the stack.h interface.
+ * @s: Stack to copy. Restored to its original contents.
+ * @size: Number of elements in s.
+ *
+ * stack.h has no copy operation, so the elements are popped into an
+ * array and pushed back on both stacks.
+ *
+ * Returns: A new stack with the same elements.
+ */
+static stack *copy_stack(stack *s, int size)
+{
+    void **elements = malloc(size * sizeof(*elements));
+    stack *copy = stack_empty(NULL);
+
+    for (int i = size - 1; i >= 0; i--) {
+        elements[i] = stack_top(s);
+        s = stack_pop(s);
+    }
+    for (int i = 0; i < size; i++) {
+        s = stack_push(s, elements[i]);
+        copy = stack_push(copy, elements[i]);
+    }
+    free(elements);
+
+    return copy;
+}
+
+/**
+ * copy_search() - Search with copy-on-branch snapshots.
+ * @s: Current state.
+ * @size: Number of elements in s.
+ * @level: Current depth in the tree.
+ *
+ * Returns: Nothing.
+ */
+static void copy_search(stack *s, int size, int level)
+{
+    if (level == depth) {
+        sample_heap();
+        return;
+    }
+    for (int b = 0; b < branching; b++) {
+        stack *child = copy_stack(s, size);
+        child = stack_push(child, &value);
+        copy_search(child, size + 1, level + 1);
+        stack_kill(child);
+    }
+}
+
+/**
+ * persistent_search() - Search with persistent snapshots.
+ * @s: Current state.
+ * @level: Current depth in the tree.
+ *
+ * Returns: Nothing.
+ */
+static void persistent_search(const pstack *s, int level)
+{
+    if (level == depth) {
+        sample_heap();
+        return;
+    }
+    for (int b = 0; b < branching; b++) {
+        pstack *child = pstack_push(s, &value);
+        persistent_search(child, level + 1);
+        pstack_kill(child);
+    }
+}
+
+// Internal function to print the result of one strategy.
+static void report(const char *name, long long ns)
+{
+    printf("%-10s depth=%d branching=%d prefill=%d %.2f ms, peak heap %zu bytes\n", name,
+           depth, branching, prefill, ns / 1e6, peak_heap - base_heap);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1) {
+        depth = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        branching = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        prefill = atoi(argv[3]);
+    }
+    if (depth < 0 || branching <= 0 || prefill < 0) {
+        fprintf(stderr, "Usage: %s [depth] [branching] [prefill]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Copy-on-branch with stack.h.
+    base_heap = peak_heap = mallinfo2().uordblks;
+    stack *s = stack_empty(NULL);
+    for (int i = 0; i < prefill; i++) {
+        s = stack_push(s, &value);
+    }
+    long long start = now_ns();
+    copy_search(s, prefill, 0);
+    report("copy", now_ns() - start);
+    stack_kill(s);
+
+    // Persistent versions with pstack.h.
+    base_heap = peak_heap = mallinfo2().uordblks;
+    pstack *p = pstack_empty(NULL);
+    for (int i = 0; i < prefill; i++) {
+        pstack *next = pstack_push(p, &value);
+        pstack_kill(p);
+        p = next;
+    }
+    start = now_ns();
+    persistent_search(p, 0);
+    report("persistent", now_ns() - start);
+    pstack_kill(p);
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "pstack.h"
+
+/**
+ * pstack_test.c - Tests for the persistent stack.
+ *
+ * This file contains tests for the stack declared in pstack.h. Besides
+ * the basic stack behaviour, the tests check that operations on one
+ * version never change another, and that each element is killed
+ * exactly once when its last version is released. Each test
+ * terminates the program with an error message if it fails.
+ *
+ * Compile with: gcc -std=c11 -I<include> pstack_test.c pstack.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ */
+
+// Number of times count_kill() has been called.
+static int kill_count = 0;
+
+// Kill function that frees the element and counts the call.
+static void count_kill(void *v)
+{
+    kill_count++;
+    free(v);
+}
+
+// Internal function to allocate an int element.
+static int *new_int(int v)
+{
+    int *p = malloc(sizeof(int));
+    *p = v;
+    return p;
+}
+
+/**
+ * push_pop_test() - Test push, top and pop on a single line of versions.
+ *
+ * Pushes three elements and checks that they are popped in reverse
+ * order, releasing each version as soon as the next one exists.
+ */
+void push_pop_test(void)
+{
+    fprintf(stderr, "Starting push_pop_test()...");
+
+    pstack *s = pstack_empty(count_kill);
+    if (!pstack_is_empty(s)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: pstack_empty() did not create an empty stack.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 1; i <= 3; i++) {
+        pstack *next = pstack_push(s, new_int(i));
+        pstack_kill(s);
+        s = next;
+    }
+    for (int i = 3; i >= 1; i--) {
+        int top = *(int *)pstack_top(s);
+        if (top != i) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: expected top %d, got %d\n", i, top);
+            exit(EXIT_FAILURE);
+        }
+        pstack *next = pstack_pop(s);
+        pstack_kill(s);
+        s = next;
+    }
+    if (!pstack_is_empty(s) || kill_count != 3) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: expected an empty stack and 3 killed elements, got %d.\n",
+                kill_count);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: elements were popped in LIFO order.\n");
+    pstack_kill(s);
+    kill_count = 0;
+}
+
+/**
+ * persistence_test() - Test that versions are independent.
+ *
+ * Builds s = [1, 2], then a = s + 3 and b = s + 4 and c = pop(s).
+ * Checks the top of every version, then releases s before the other
+ * versions and checks that the shared elements are still intact.
+ */
+void persistence_test(void)
+{
+    fprintf(stderr, "Starting persistence_test()...");
+
+    pstack *empty = pstack_empty(count_kill);
+    pstack *s1 = pstack_push(empty, new_int(1));
+    pstack *s = pstack_push(s1, new_int(2));
+    pstack_kill(empty);
+    pstack_kill(s1);
+
+    pstack *a = pstack_push(s, new_int(3));
+    pstack *b = pstack_push(s, new_int(4));
+    pstack *c = pstack_pop(s);
+
+    if (*(int *)pstack_top(s) != 2 || *(int *)pstack_top(a) != 3 ||
+        *(int *)pstack_top(b) != 4 || *(int *)pstack_top(c) != 1) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: a version was changed by an operation on another.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Element 2 is still shared by a and b.
+    pstack_kill(s);
+    pstack *a2 = pstack_pop(a);
+    if (kill_count != 0 || *(int *)pstack_top(a2) != 2) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: a shared element was killed too early.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    pstack_kill(a);
+    pstack_kill(a2);
+    pstack_kill(b);
+    if (kill_count != 3) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: expected 3 killed elements, got %d.\n", kill_count);
+        exit(EXIT_FAILURE);
+    }
+    pstack_kill(c);
+    if (kill_count != 4) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: expected 4 killed elements, got %d.\n", kill_count);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: versions were independent.\n");
+    kill_count = 0;
+}
+
+/**
+ * clone_test() - Test pstack_clone.
+ *
+ * Clones a deep stack, kills the original and checks that the clone
+ * still holds all elements.
+ */
+void clone_test(void)
+{
+    fprintf(stderr, "Starting clone_test()...");
+
+    int n = 100000;
+    pstack *s = pstack_empty(count_kill);
+    for (int i = 0; i < n; i++) {
+        pstack *next = pstack_push(s, new_int(i));
+        pstack_kill(s);
+        s = next;
+    }
+
+    pstack *clone = pstack_clone(s);
+    pstack_kill(s);
+
+    for (int i = n - 1; i >= 0; i--) {
+        if (*(int *)pstack_top(clone) != i) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: clone lost element %d.\n", i);
+            exit(EXIT_FAILURE);
+        }
+        pstack *next = pstack_pop(clone);
+        pstack_kill(clone);
+        clone = next;
+    }
+    if (kill_count != n) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: expected %d killed elements, got %d.\n", n, kill_count);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: the clone held all %d elements.\n", n);
+    pstack_kill(clone);
+    kill_count = 0;
+}
+
+int main(void)
+{
+    push_pop_test();        // Test push, top and pop
+    persistence_test();     // Test that versions are independent
+    clone_test();           // Test pstack_clone
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
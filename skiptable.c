@@ -0,0 +1,1057 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h> // For isspace()
+#include <stdarg.h>
+#include <stdatomic.h>
+
+#include <table.h>
+
+#include "table_ext.h"
+
+// Maximum number of levels. With a level probability of 1/4, 16
+// levels keep the expected search cost logarithmic up to 4^16 keys.
+#define MAX_LEVEL 16
+
+/*
+ * Implementation of a generic table for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The table is a skip list ordered by the key compare function, which
+ * must define a total order. Every node is on level 0, a sorted linked
+ * list of all entries, and on each higher level with probability 1/4,
+ * so searches, inserts and removals take O(log n) expected time and
+ * modify only the links around the position. Inserting a key that is
+ * already in the table replaces its key and value, so the table holds
+ * no duplicates.
+ *
+ * Concurrency: one writer thread may call table_insert(),
+ * table_remove() and table_update() while any number of other threads
+ * call table_lookup(), table_range(), table_is_empty(),
+ * table_choose_key(), table_print() and table_print_internal().
+ * Writers must be serialized by the caller, and table_empty() and
+ * table_kill() must not run concurrently with any other operation.
+ *  - A new node is filled in before it is linked, and its links are
+ *    published bottom-up with release stores, so a reader that finds
+ *    the node also sees its contents. A node is in the table once it
+ *    is linked on level 0.
+ *  - A removed node is unlinked from the top down. Its own links are
+ *    left intact, so a reader standing on it can continue its search.
+ *  - Removed nodes, and the old key and value replaced by an insert,
+ *    are freed with deferred reclamation. A reader registers in one of
+ *    two counters, chosen by the parity of a global epoch, for the
+ *    duration of the operation. A node retired in epoch e is freed
+ *    when no reader that registered in epoch e or earlier remains;
+ *    if no reader is registered at all, it is freed at once. The kill
+ *    functions are thus called later than in the other tables when
+ *    readers are active, but always by the writer or table_kill().
+ *
+ * A value returned by table_lookup() is only protected until the
+ * lookup returns. Changing a value in place with table_update() is not
+ * synchronized with readers.
+ *
+ * The implementation uses C11 atomics and must be compiled with
+ * -std=c11 or later.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: table_choose_key registers as a reader.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct node {
+    _Atomic(void *) key;
+    _Atomic(void *) value;
+    int level; // Number of levels the node is linked on
+    struct node *retired_next; // Next node on a retired list
+    _Atomic(struct node *) next[]; // Successor on each level
+} node;
+
+struct table {
+    node *head; // Sentinel node with MAX_LEVEL levels and no key
+    _Atomic int level; // Number of levels in use, at least 1
+    unsigned random_state; // State of the level generator, writer only
+    _Atomic unsigned epoch; // Reclamation epoch, changed by the writer
+    _Atomic long active[2]; // Registered readers per epoch parity
+    node *retired[2]; // Nodes retired per epoch parity
+    compare_function *key_cmp_func;
+    kill_function key_kill_func;
+    kill_function value_kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * node_create() - Allocate a node.
+ * @key: The key of the node.
+ * @value: The value of the node.
+ * @level: Number of levels, from 0 to MAX_LEVEL.
+ *
+ * A node with 0 levels is never linked and only carries a replaced
+ * key and value to reclamation.
+ *
+ * Returns: A pointer to the node, with all links NULL.
+ */
+static node *node_create(void *key, void *value, int level)
+{
+    node *n = malloc(sizeof(node) + level * sizeof(_Atomic(node *)));
+
+    atomic_init(&n->key, key);
+    atomic_init(&n->value, value);
+    n->level = level;
+    n->retired_next = NULL;
+    for (int i = 0; i < level; i++) {
+        atomic_init(&n->next[i], NULL);
+    }
+    return n;
+}
+
+/**
+ * node_kill() - Kill the key and value of a node and free it.
+ * @t: Table that owned the node.
+ * @n: Node to free.
+ *
+ * NULL keys and values are not passed to the kill functions.
+ *
+ * Returns: Nothing.
+ */
+static void node_kill(const table *t, node *n)
+{
+    void *key = atomic_load_explicit(&n->key, memory_order_relaxed);
+    void *value = atomic_load_explicit(&n->value, memory_order_relaxed);
+
+    if (t->key_kill_func != NULL && key != NULL) {
+        t->key_kill_func(key);
+    }
+    if (t->value_kill_func != NULL && value != NULL) {
+        t->value_kill_func(value);
+    }
+    free(n);
+}
+
+// Internal function to advance the level generator and draw a level.
+static int random_level(table *t)
+{
+    int level = 1;
+
+    while (level < MAX_LEVEL) {
+        unsigned x = t->random_state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        t->random_state = x;
+        if ((x & 3) != 0) {
+            break;
+        }
+        level++;
+    }
+    return level;
+}
+
+/**
+ * reader_enter() - Register a reader.
+ * @t: Table to read.
+ *
+ * The seq_cst fence pairs with the one in reclaim(): either the
+ * writer sees the registration, or the reader sees every unlink that
+ * the writer made before its check.
+ *
+ * Returns: The epoch parity to pass to reader_exit().
+ */
+static int reader_enter(const table *t)
+{
+    table *w = (table *)t;
+
+    for (;;) {
+        unsigned e = atomic_load_explicit(&w->epoch, memory_order_relaxed);
+        atomic_fetch_add_explicit(&w->active[e & 1], 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (atomic_load_explicit(&w->epoch, memory_order_relaxed) == e) {
+            return e & 1;
+        }
+        // The epoch moved on. Register in the current one instead.
+        atomic_fetch_sub_explicit(&w->active[e & 1], 1, memory_order_release);
+    }
+}
+
+// Internal function to unregister a reader. The release pairs with the
+// acquire in reclaim(), so that the reads are done before a free.
+static void reader_exit(const table *t, int parity)
+{
+    atomic_fetch_sub_explicit(&((table *)t)->active[parity], 1, memory_order_release);
+}
+
+// Internal function to free all nodes of a retired list.
+static void free_retired(table *t, int parity)
+{
+    node *n = t->retired[parity];
+
+    while (n != NULL) {
+        node *next = n->retired_next;
+        node_kill(t, n);
+        n = next;
+    }
+    t->retired[parity] = NULL;
+}
+
+/**
+ * reclaim() - Free the retired nodes that no reader can reach.
+ * @t: Table to manipulate.
+ *
+ * Called by the writer after each change. If the readers of the
+ * previous epoch are gone, the nodes retired then are freed and the
+ * epoch is advanced. If there are no readers at all, the nodes
+ * retired in the current epoch are freed too.
+ *
+ * Returns: Nothing.
+ */
+static void reclaim(table *t)
+{
+    if (t->retired[0] == NULL && t->retired[1] == NULL) {
+        return;
+    }
+    atomic_thread_fence(memory_order_seq_cst);
+
+    unsigned e = atomic_load_explicit(&t->epoch, memory_order_relaxed);
+    int cur = e & 1;
+    int prev = cur ^ 1;
+
+    if (atomic_load_explicit(&t->active[prev], memory_order_acquire) != 0) {
+        return;
+    }
+    free_retired(t, prev);
+    if (atomic_load_explicit(&t->active[cur], memory_order_acquire) == 0) {
+        free_retired(t, cur);
+    }
+    atomic_store_explicit(&t->epoch, e + 1, memory_order_seq_cst);
+}
+
+// Internal function to put a node on the retired list of the current epoch.
+static void retire(table *t, node *n)
+{
+    int cur = atomic_load_explicit(&t->epoch, memory_order_relaxed) & 1;
+
+    n->retired_next = t->retired[cur];
+    t->retired[cur] = n;
+}
+
+/**
+ * find_preds() - Find the predecessors of a key on every level.
+ * @t: Table to inspect.
+ * @key: Key to search for.
+ * @preds: Set to the last node before key on each level in use.
+ *
+ * Only called by the writer, which is the only thread that changes
+ * links, so the loads need no ordering.
+ *
+ * Returns: The first node whose key is not less than key, or NULL.
+ */
+static node *find_preds(const table *t, const void *key, node **preds)
+{
+    node *x = t->head;
+    int level = atomic_load_explicit(&((table *)t)->level, memory_order_relaxed);
+
+    for (int i = level - 1; i >= 0; i--) {
+        node *next = atomic_load_explicit(&x->next[i], memory_order_relaxed);
+        while (next != NULL
+               && t->key_cmp_func(atomic_load_explicit(&next->key, memory_order_relaxed),
+                                  key) < 0) {
+            x = next;
+            next = atomic_load_explicit(&x->next[i], memory_order_relaxed);
+        }
+        preds[i] = x;
+    }
+    return atomic_load_explicit(&x->next[0], memory_order_relaxed);
+}
+
+/**
+ * find_ge() - Find the first node whose key is not less than a key.
+ * @t: Table to inspect.
+ * @key: Key to search for.
+ *
+ * Called by readers, between reader_enter() and reader_exit().
+ *
+ * Returns: The node, or NULL if all keys are less than key.
+ */
+static node *find_ge(const table *t, const void *key)
+{
+    node *x = t->head;
+    node *next = NULL;
+    int level = atomic_load_explicit(&((table *)t)->level, memory_order_relaxed);
+
+    for (int i = level - 1; i >= 0; i--) {
+        next = atomic_load_explicit(&x->next[i], memory_order_acquire);
+        while (next != NULL
+               && t->key_cmp_func(atomic_load_explicit(&next->key, memory_order_acquire),
+                                  key) < 0) {
+            x = next;
+            next = atomic_load_explicit(&x->next[i], memory_order_acquire);
+        }
+    }
+    // Return the node that was compared. Loading x->next[0] again could
+    // return a smaller key that the writer has linked since.
+    return next;
+}
+
+// Internal function to check if a node has a given key.
+static bool has_key(const table *t, node *n, const void *key)
+{
+    return n != NULL
+        && t->key_cmp_func(atomic_load_explicit(&n->key, memory_order_acquire), key) == 0;
+}
+
+/**
+ * link_node() - Create and link a node for a new key.
+ * @t: Table to manipulate.
+ * @preds: The predecessors found by find_preds().
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Returns: Nothing.
+ */
+static void link_node(table *t, node **preds, void *key, void *value)
+{
+    int level = random_level(t);
+    int old_level = atomic_load_explicit(&t->level, memory_order_relaxed);
+
+    for (int i = old_level; i < level; i++) {
+        preds[i] = t->head;
+    }
+
+    node *n = node_create(key, value, level);
+    for (int i = 0; i < level; i++) {
+        node *next = atomic_load_explicit(&preds[i]->next[i], memory_order_relaxed);
+        atomic_init(&n->next[i], next);
+    }
+    // Publish bottom-up. The release makes the node contents visible
+    // to any reader that follows the new link.
+    for (int i = 0; i < level; i++) {
+        atomic_store_explicit(&preds[i]->next[i], n, memory_order_release);
+    }
+    if (level > old_level) {
+        atomic_store_explicit(&t->level, level, memory_order_release);
+    }
+}
+
+/**
+ * replace_entry() - Replace the key and value of a node.
+ * @t: Table to manipulate.
+ * @n: Node to change.
+ * @key: The new key, or NULL to keep the old one.
+ * @value: The new value.
+ *
+ * The replaced key and value are retired, since readers may still
+ * use them.
+ *
+ * Returns: Nothing.
+ */
+static void replace_entry(table *t, node *n, void *key, void *value)
+{
+    void *old_key = NULL;
+    void *old_value = atomic_load_explicit(&n->value, memory_order_relaxed);
+
+    if (key != NULL) {
+        old_key = atomic_load_explicit(&n->key, memory_order_relaxed);
+        atomic_store_explicit(&n->key, key, memory_order_release);
+        if (old_key == key) {
+            old_key = NULL;
+        }
+    }
+    atomic_store_explicit(&n->value, value, memory_order_release);
+    if (old_value == value) {
+        old_value = NULL;
+    }
+    if (old_key != NULL || old_value != NULL) {
+        retire(t, node_create(old_key, old_value, 0));
+    }
+}
+
+// ==========INTERFACE==========
+
+/**
+ * table_empty() - Create an empty table.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ *                Must return a negative, zero or positive value, as
+ *                for qsort().
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty(compare_function *key_cmp_func,
+                   kill_function key_kill_func,
+                   kill_function value_kill_func)
+{
+    table *t = calloc(1, sizeof(table));
+
+    t->head = node_create(NULL, NULL, MAX_LEVEL);
+    atomic_init(&t->level, 1);
+    t->random_state = 2463534242u;
+    atomic_init(&t->epoch, 0);
+    atomic_init(&t->active[0], 0);
+    atomic_init(&t->active[1], 0);
+
+    // Store the key compare function and key/value kill functions.
+    t->key_cmp_func = key_cmp_func;
+    t->key_kill_func = key_kill_func;
+    t->value_kill_func = value_kill_func;
+
+    return t;
+}
+
+/**
+ * table_is_empty() - Check if a table is empty.
+ * @table: Table to check.
+ *
+ * Returns: True if table contains no key/value pairs, false otherwise.
+ */
+bool table_is_empty(const table *t)
+{
+    return atomic_load_explicit(&t->head->next[0], memory_order_acquire) == NULL;
+}
+
+/**
+ * table_insert() - Add a key/value pair to a table.
+ * @table: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Insert the key/value pair into the table. If the key is already in
+ * the table, its old key and value are replaced and later
+ * de-allocated with the kill functions. Must not run concurrently
+ * with another writer.
+ *
+ * Returns: Nothing.
+ */
+void table_insert(table *t, void *key, void *value)
+{
+    node *preds[MAX_LEVEL];
+    node *n = find_preds(t, key, preds);
+
+    if (has_key(t, n, key)) {
+        replace_entry(t, n, key, value);
+    } else {
+        link_node(t, preds, key, value);
+    }
+    reclaim(t);
+}
+
+/**
+ * table_lookup() - Look up a given key in a table.
+ * @table: Table to inspect.
+ * @key: Key to look up.
+ *
+ * May run concurrently with one writer.
+ *
+ * Returns: The value corresponding to a given key, or NULL if the key
+ * is not found in the table.
+ */
+void *table_lookup(const table *t, const void *key)
+{
+    int parity = reader_enter(t);
+    node *n = find_ge(t, key);
+    void *value = NULL;
+
+    if (has_key(t, n, key)) {
+        value = atomic_load_explicit(&n->value, memory_order_acquire);
+    }
+    reader_exit(t, parity);
+    return value;
+}
+
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * See table_ext.h. Must not run concurrently with another writer. A
+ * replaced value is retired like a removed node.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx)
+{
+    node *preds[MAX_LEVEL];
+    node *n = find_preds(t, key, preds);
+    void *value;
+
+    if (has_key(t, n, key)) {
+        value = fn(atomic_load_explicit(&n->value, memory_order_relaxed), true, ctx);
+        replace_entry(t, n, NULL, value);
+    } else {
+        value = fn(NULL, false, ctx);
+        if (value != NULL) {
+            link_node(t, preds, key, value);
+        }
+    }
+    reclaim(t);
+    return value;
+}
+
+/**
+ * table_range() - Visit the entries between two keys in order.
+ * @t: Table to inspect.
+ * @lo: Lowest key to visit, or NULL to start at the smallest key.
+ * @hi: Highest key to visit, or NULL to end at the largest key.
+ * @callback: Function called for each entry.
+ * @ctx: Context pointer passed on to callback.
+ *
+ * See table_ext.h. May run concurrently with one writer; keys that
+ * are inserted or removed during the scan may or may not be visited,
+ * but the visited keys are always in ascending order.
+ *
+ * Returns: The number of visited entries.
+ */
+int table_range(const table *t, const void *lo, const void *hi,
+                range_callback *callback, void *ctx)
+{
+    int parity = reader_enter(t);
+    node *n;
+    int count = 0;
+
+    if (lo != NULL) {
+        n = find_ge(t, lo);
+    } else {
+        n = atomic_load_explicit(&t->head->next[0], memory_order_acquire);
+    }
+    while (n != NULL) {
+        void *key = atomic_load_explicit(&n->key, memory_order_acquire);
+        if (hi != NULL && t->key_cmp_func(key, hi) > 0) {
+            break;
+        }
+        callback(key, atomic_load_explicit(&n->value, memory_order_acquire), ctx);
+        count++;
+        n = atomic_load_explicit(&n->next[0], memory_order_acquire);
+    }
+    reader_exit(t, parity);
+    return count;
+}
+
+/**
+ * table_concurrent_lookup() - Check if lookups may run concurrently with a writer.
+ *
+ * See table_ext.h.
+ *
+ * Returns: True.
+ */
+bool table_concurrent_lookup(void)
+{
+    return true;
+}
+
+/**
+ * table_choose_key() - Return an arbitrary key.
+ * @t: Table to inspect.
+ *
+ * Return an arbitrary key stored in the table. Can be used together
+ * with table_remove() to deconstruct the table. Undefined for an
+ * empty table. If the writer empties the table concurrently, NULL is
+ * returned. As for table_lookup(), the key is only protected until
+ * the function returns.
+ *
+ * Returns: The smallest key, or NULL.
+ */
+void *table_choose_key(const table *t)
+{
+    int parity = reader_enter(t);
+    node *n = atomic_load_explicit(&t->head->next[0], memory_order_acquire);
+    void *key = NULL;
+
+    if (n != NULL) {
+        key = atomic_load_explicit(&n->key, memory_order_acquire);
+    }
+    reader_exit(t, parity);
+    return key;
+}
+
+/**
+ * table_remove() - Remove a key/value pair in the table.
+ * @table: Table to manipulate.
+ * @key: Key for which to remove pair.
+ *
+ * Will call any kill functions set for keys/values, possibly after
+ * the concurrent readers are done. Does nothing if key is not found
+ * in the table. Must not run concurrently with another writer.
+ *
+ * Returns: Nothing.
+ */
+void table_remove(table *t, const void *key)
+{
+    node *preds[MAX_LEVEL];
+    node *n = find_preds(t, key, preds);
+
+    if (!has_key(t, n, key)) {
+        return;
+    }
+
+    // Unlink from the top down. n keeps its own links for readers
+    // that are standing on it.
+    for (int i = n->level - 1; i >= 0; i--) {
+        node *next = atomic_load_explicit(&n->next[i], memory_order_relaxed);
+        atomic_store_explicit(&preds[i]->next[i], next, memory_order_release);
+    }
+
+    // Drop empty top levels.
+    int level = atomic_load_explicit(&t->level, memory_order_relaxed);
+    while (level > 1
+           && atomic_load_explicit(&t->head->next[level - 1], memory_order_relaxed) == NULL) {
+        level--;
+    }
+    atomic_store_explicit(&t->level, level, memory_order_release);
+
+    // key may point to the stored key, which is killed by reclaim().
+    retire(t, n);
+    reclaim(t);
+}
+
+/*
+ * table_kill() - Destroy a table.
+ * @table: Table to destroy.
+ *
+ * Return all dynamic memory used by the table and its elements. If a
+ * kill_func was registered for keys and/or values at table creation,
+ * it is called each element to kill any user-allocated memory
+ * occupied by the element values. Must not run concurrently with any
+ * other operation.
+ *
+ * Returns: Nothing.
+ */
+void table_kill(table *t)
+{
+    free_retired(t, 0);
+    free_retired(t, 1);
+
+    node *n = atomic_load_explicit(&t->head->next[0], memory_order_relaxed);
+    while (n != NULL) {
+        node *next = atomic_load_explicit(&n->next[0], memory_order_relaxed);
+        node_kill(t, n);
+        n = next;
+    }
+    free(t->head);
+    free(t);
+}
+
+/**
+ * table_print() - Print the given table.
+ * @t: Table to print.
+ * @print_func: Function called for each key/value pair in the table.
+ *
+ * Iterates over the key/value pairs in the table in ascending key
+ * order and prints them.
+ *
+ * Returns: Nothing.
+ */
+void table_print(const table *t, inspect_callback_pair print_func)
+{
+    int parity = reader_enter(t);
+    node *n = atomic_load_explicit(&t->head->next[0], memory_order_acquire);
+
+    while (n != NULL) {
+        print_func(atomic_load_explicit(&n->key, memory_order_acquire),
+                   atomic_load_explicit(&n->value, memory_order_acquire));
+        n = atomic_load_explicit(&n->next[0], memory_order_acquire);
+    }
+    reader_exit(t, parity);
+}
+
+// ===========INTERNAL FUNCTIONS USED BY table_print_internal ============
+
+// The functions below output code in the dot language, used by
+// GraphViz. For documention of the dot language, see graphviz.org.
+
+/**
+ * indent() - Output indentation string.
+ * @n: Indentation level.
+ *
+ * Print n tab characters.
+ *
+ * Returns: Nothing.
+ */
+static void indent(int n)
+{
+    for (int i=0; i<n; i++) {
+        printf("\t");
+    }
+}
+
+/**
+ * iprintf(...) - Indent and print.
+ * @n: Indentation level
+ * @...: printf arguments
+ *
+ * Print n tab characters and calls printf.
+ *
+ * Returns: Nothing.
+ */
+static void iprintf(int n, const char *fmt, ...)
+{
+    // Indent...
+    indent(n);
+    // ...and call printf
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * print_edge() - Print a edge between two addresses.
+ * @from: The address of the start of the edge. Should be non-NULL.
+ * @to: The address of the destination for the edge, including NULL.
+ * @port: The name of the port on the source node, or NULL.
+ * @label: The label for the edge, or NULL.
+ * @options: A string with other edge options, or NULL.
+ *
+ * Print an edge from port PORT on node FROM to TO with label
+ * LABEL. If to is NULL, the destination is the NULL node, otherwise a
+ * memory node. If the port is NULL, the edge starts at the node, not
+ * a specific port on it. If label is NULL, no label is used. The
+ * options string, if non-NULL, is printed before the label.
+ *
+ * Returns: Nothing.
+ */
+static void print_edge(int indent_level, const void *from, const void *to, const char *port,
+                       const char *label, const char *options)
+{
+    indent(indent_level);
+    if (port) {
+        printf("m%04lx:%s -> ", PTR2ADDR(from), port);
+    } else {
+        printf("m%04lx -> ", PTR2ADDR(from));
+    }
+    if (to == NULL) {
+        printf("NULL");
+    } else {
+        printf("m%04lx", PTR2ADDR(to));
+    }
+    printf(" [");
+    if (options != NULL) {
+        printf("%s", options);
+    }
+    if (label != NULL) {
+        printf(" label=\"%s\"",label);
+    }
+    printf("]\n");
+}
+
+/**
+ * print_head_node() - Print a node corresponding to the table struct.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ *
+ * Returns: Nothing.
+ */
+static void print_head_node(int indent_level, const table *t)
+{
+    iprintf(indent_level, "m%04lx [shape=record "
+            "label=\"head\\n%04lx|level\\n%d|epoch\\n%u|cmp\\n%04lx|key_kill\\n%04lx"
+            "|value_kill\\n%04lx\"]\n",
+            PTR2ADDR(t), PTR2ADDR(t->head),
+            atomic_load_explicit(&t->level, memory_order_relaxed),
+            atomic_load_explicit(&t->epoch, memory_order_relaxed),
+            PTR2ADDR(t->key_cmp_func), PTR2ADDR(t->key_kill_func),
+            PTR2ADDR(t->value_kill_func));
+}
+
+// Internal function to print the key and value nodes in dot format.
+static void print_key_value_nodes(int indent_level, const void *key, const void *value,
+                                  inspect_callback key_print_func,
+                                  inspect_callback value_print_func)
+{
+    if (key != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(key));
+        if (key_print_func != NULL) {
+            key_print_func(key);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(key));
+    }
+    if (value != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(value));
+        if (value_print_func != NULL) {
+            value_print_func(value);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(value));
+    }
+}
+
+/**
+ * print_entry() - Print one entry in dot format.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ * @e: Address of the entry, used as the name of its node.
+ * @i: Position of the entry in the printout.
+ * @key: Key of the entry.
+ * @value: Value of the entry.
+ * @key_print_func: Function called for the key.
+ * @value_print_func: Function called for the value.
+ * @payload: If true, print the key and value nodes, otherwise the
+ *           entry node and its edges.
+ *
+ * The entry is drawn as an edge from the head node labelled with its
+ * position. Memory "owned" by the table is indicated by solid red
+ * lines. Memory "borrowed" from the user is indicated by red dashed
+ * lines.
+ *
+ * Returns: Nothing.
+ */
+static void print_entry(int indent_level, const table *t, const void *e, int i,
+                        const void *key, const void *value,
+                        inspect_callback key_print_func,
+                        inspect_callback value_print_func, bool payload)
+{
+    if (payload) {
+        print_key_value_nodes(indent_level, key, value, key_print_func, value_print_func);
+        return;
+    }
+    char label[16];
+    snprintf(label, sizeof(label), "%d", i);
+
+    iprintf(indent_level, "m%04lx [shape=record label=\"<k>key\\n%04lx|<v>value\\n%04lx\"]\n",
+            PTR2ADDR(e), PTR2ADDR(key), PTR2ADDR(value));
+    print_edge(indent_level, t, e, NULL, label, NULL);
+    if (key == NULL) {
+        print_edge(indent_level, e, key, "k", "key", NULL);
+    } else if (t->key_kill_func) {
+        print_edge(indent_level, e, key, "k", "key", "color=red");
+    } else {
+        print_edge(indent_level, e, key, "k", "key", "color=red style=dashed");
+    }
+    if (value == NULL) {
+        print_edge(indent_level, e, value, "v", "value", NULL);
+    } else if (t->value_kill_func) {
+        print_edge(indent_level, e, value, "v", "value", "color=red");
+    } else {
+        print_edge(indent_level, e, value, "v", "value", "color=red style=dashed");
+    }
+}
+
+// Internal function to print the nodes on level 0 in dot format. Must
+// be called by a registered reader or by the writer.
+static void print_entries(int indent_level, const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, bool payload)
+{
+    node *n = atomic_load_explicit(&t->head->next[0], memory_order_acquire);
+
+    for (int i = 0; n != NULL; i++) {
+        print_entry(indent_level, t, n, i, atomic_load_explicit(&n->key, memory_order_acquire),
+                    atomic_load_explicit(&n->value, memory_order_acquire),
+                    key_print_func, value_print_func, payload);
+        n = atomic_load_explicit(&n->next[0], memory_order_acquire);
+    }
+}
+
+// Create an escaped version of the input string. The most common
+// control characters - newline, horizontal tab, backslash, and double
+// quote - are replaced by their escape sequence. The returned pointer
+// must be deallocated by the caller.
+static char *escape_chars(const char *s)
+{
+    int i, j;
+    int escaped = 0; // The number of chars that must be escaped.
+
+    // Count how many chars need to be escaped, i.e. how much longer
+    // the output string will be.
+    for (i = escaped = 0; s[i] != '\0'; i++) {
+        if (s[i] == '\n' || s[i] == '\t' || s[i] == '\\' || s[i] == '\"') {
+            escaped++;
+        }
+    }
+    // Allocate space for the escaped string. The variable i holds the input
+    // length, escaped how much the string will grow.
+    char *t = malloc(i + escaped + 1);
+
+    // Copy-and-escape loop
+    for (i = j = 0; s[i] != '\0'; i++) {
+        // Convert each control character by its escape sequence.
+        // Non-control characters are copied as-is.
+        switch (s[i]) {
+        case '\n': t[i+j] = '\\'; t[i+j+1] = 'n';  j++; break;
+        case '\t': t[i+j] = '\\'; t[i+j+1] = 't';  j++; break;
+        case '\\': t[i+j] = '\\'; t[i+j+1] = '\\'; j++; break;
+        case '\"': t[i+j] = '\\'; t[i+j+1] = '\"'; j++; break;
+        default:   t[i+j] = s[i]; break;
+        }
+    }
+    // Terminal the output string
+    t[i+j] = '\0';
+    return t;
+}
+
+/**
+ * first_white_spc() - Return pointer to first white-space char.
+ * @s: String.
+ *
+ * Returns: A pointer to the first white-space char in s, or NULL if none is found.
+ *
+ */
+static const char *find_white_spc(const char *s)
+{
+    const char *t = s;
+    while (*t != '\0') {
+        if (isspace(*t)) {
+            // We found a white-space char, return a point to it.
+            return t;
+        }
+        // Advance to next char
+        t++;
+    }
+    // No white-space found
+    return NULL;
+}
+
+/**
+ * insert_table_name() - Maybe insert the name of the table src file in the description string.
+ * @s: Description string.
+ *
+ * Parses the description string to find of if it starts with a c file
+ * name. In that case, the file name of this file is spliced into the
+ * description string. The parsing is not very intelligent: If the
+ * sequence ".c:" (case insensitive) is found before the first
+ * white-space, the string up to and including ".c" is taken to be a c
+ * file name.
+ *
+ * Returns: A dynamic copy of s, optionally including with the table src file name.
+ */
+static char *insert_table_name(const char *s)
+{
+    // First, determine if the description string starts with a c file name
+    // a) Search for the string ".c:"
+    const char *dot_c = strstr(s, ".c:");
+    // b) Search for the first white-space
+    const char *spc = find_white_spc(s);
+
+    bool prefix_found;
+    int output_length;
+
+    // If both a) and b) are found AND a) is before b, we assume that
+    // s starts with a file name
+    if (dot_c != NULL && spc != NULL && dot_c < spc) {
+        // We found a match. Output string is input + 3 chars + __FILE__
+        prefix_found = true;
+        output_length = strlen(s) + 3 + strlen(__FILE__);
+    } else {
+        // No match found. Output string is just input
+        prefix_found = false;
+        output_length = strlen(s);
+    }
+
+    // Allocate space for the whole string
+    char *out = calloc(1, output_length + 1);
+    strcpy(out, s);
+    if (prefix_found) {
+        // Overwrite the output buffer from the ":"
+        strcpy(out + (dot_c - s + 2), " (");
+        // Now out will be 0-terminated after "(", append the file name and ")"
+        strcat(out, __FILE__);
+        strcat(out, ")");
+        // Finally append the input string from the : onwards
+        strcat(out, dot_c + 2);
+    }
+    return out;
+}
+
+/**
+ * table_print_internal() - Output the internal structure of the table.
+ * @t: Table to print.
+ * @key_print_func: Function called for each key in the table.
+ * @value_print_func: Function called for each value in the table.
+ * @desc: String with a description/state of the list.
+ * @indent_level: Indentation level, 0 for outermost
+ *
+ * Prints code that shows the nodes of level 0 in ascending key order,
+ * each as an edge from the table struct labelled with its position;
+ * the higher levels are not shown. The function registers as a reader,
+ * like table_print(). If the writer runs concurrently, the two
+ * printouts of the entries may differ.
+ *
+ * Returns: Nothing.
+ */
+void table_print_internal(const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, const char *desc,
+                          int indent_level)
+{
+    // Readers may print concurrently.
+    static _Atomic int graph_count = 0;
+    int graph_number = atomic_fetch_add(&graph_count, 1) + 1;
+    int il = indent_level;
+    int parity = reader_enter(t);
+
+
+    if (indent_level == 0) {
+        // If this is the outermost datatype, start a graph and set up defaults
+        printf("digraph TABLE_%d {\n", graph_number);
+
+        // Specify default shape and fontname
+        il++;
+        iprintf(il, "node [shape=rectangle fontname=\"Courier New\"]\n");
+        iprintf(il, "ranksep=0.01\n");
+        iprintf(il, "subgraph cluster_nullspace {\n");
+        iprintf(il+1, "NULL\n");
+        iprintf(il, "}\n");
+    }
+
+    if (desc != NULL) {
+        // Escape the string before printout
+        char *escaped = escape_chars(desc);
+        // Optionally, splice the source file name
+        char *spliced = insert_table_name(escaped);
+
+        // Use different names on inner description nodes
+        if (indent_level == 0) {
+            iprintf(il, "description [label=\"%s\"]\n", spliced);
+        } else {
+            iprintf(il, "\tcluster_list_%d_description [label=\"%s\"]\n", graph_number, spliced);
+        }
+        // Return the memory used by the spliced and escaped strings
+        free(spliced);
+        free(escaped);
+    }
+
+    if (indent_level == 0) {
+        // Use a single "pointer" edge as a starting point for the
+        // outermost datatype
+        iprintf(il, "t [label=\"%04lx\" xlabel=\"t\"]\n", PTR2ADDR(t));
+        iprintf(il, "t -> m%04lx\n", PTR2ADDR(t));
+    }
+
+    if (indent_level == 0) {
+        // Put the user nodes in userspace
+        iprintf(il, "subgraph cluster_userspace { label=\"User space\"\n");
+        il++;
+
+        // Print the key and value nodes
+        print_entries(il, t, key_print_func, value_print_func, true);
+
+        // Close the subgraph
+        il--;
+        iprintf(il, "}\n");
+    }
+
+    // Print the subgraph to surround the table content
+    iprintf(il, "subgraph cluster_table_%d { label=\"Table\"\n", graph_number);
+    il++;
+
+    // Output the head node
+    print_head_node(il, t);
+
+    // Output the entries and their edges
+    print_entries(il, t, key_print_func, value_print_func, false);
+
+    // Close the subgraph
+    il--;
+    iprintf(il, "}\n");
+
+    if (indent_level == 0) {
+        // Termination of graph
+        printf("}\n");
+    }
+
+    reader_exit(t, parity);
+}
@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "table_ext.h"
+#include "int_fixture.h"
+
+/**
+ * skiptable_test.c - Tests for concurrent readers of skiptable.c.
+ *
+ * This file contains tests of lookups and range scans that run
+ * concurrently with a writer, as described in skiptable.c. The keys
+ * and values are allocated and freed by the kill functions, so
+ * compiling with -fsanitize=address also detects a node, key or value
+ * that is freed while a reader uses it. Each test terminates the
+ * program with an error message if it fails. choose_test() uses keys
+ * that are not freed, so that the returned keys can be checked.
+ *
+ * Compile with: gcc -std=c11 -pthread -I<include> skiptable_test.c skiptable.c int_fixture.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Added choose_test().
+ * 2026-10-18 v1.2: Use the helpers of int_fixture.c.
+ */
+
+// Number of keys, reader threads and writer rounds.
+#define N 512
+#define READERS 3
+#define ROUNDS 200
+
+// Set by the writer when it is done.
+static atomic_bool done;
+
+// The counters of int_fixture.c are not atomic. Only the writer and
+// table_kill() call kill_int().
+
+// Range callback that checks the entries. ctx points to the previous
+// key, which is updated.
+static void check_entry(const void *key, void *value, void *ctx)
+{
+    int *prev = ctx;
+    int k = *(const int *)key;
+
+    if (k <= *prev || *(int *)value != k) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: a range scan saw key %d after %d with value %d.\n", k, *prev,
+                *(int *)value);
+        exit(EXIT_FAILURE);
+    }
+    *prev = k;
+}
+
+/**
+ * reader() - Check the table until the writer is done.
+ * @arg: The table.
+ *
+ * The even keys are always in the table, so every lookup of an even
+ * key must succeed, and every range scan must visit all even keys of
+ * the range, in ascending order, with values equal to the keys.
+ *
+ * Returns: NULL.
+ */
+static void *reader(void *arg)
+{
+    table *t = arg;
+    unsigned state = (unsigned)(size_t)pthread_self() | 1;
+
+    while (!atomic_load(&done)) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        int k = 2 * (int)(state % (N / 2));
+
+        if (table_lookup(t, &k) == NULL) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: lookup of the present key %d failed.\n", k);
+            exit(EXIT_FAILURE);
+        }
+
+        int hi = k + 64;
+        int prev = k - 1;
+        int n = table_range(t, &k, &hi, check_entry, &prev);
+        int evens = (hi < N ? 64 : N - 1 - k) / 2 + 1;
+        if (n < evens) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: range [%d, %d] visited %d keys, expected at least %d.\n",
+                    k, hi, n, evens);
+            exit(EXIT_FAILURE);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * concurrent_test() - Test readers that run concurrently with a writer.
+ *
+ * The writer inserts and removes the odd keys and replaces the keys
+ * and values of the even keys, while READERS threads run reader().
+ * Afterwards, every allocated key and value must have been killed
+ * exactly once.
+ */
+void concurrent_test(void)
+{
+    fprintf(stderr, "Starting concurrent_test()...");
+
+    table *t = table_empty(compare_int, kill_int, kill_int);
+    for (int k = 0; k < N; k += 2) {
+        table_insert(t, new_int(k), new_int(k));
+    }
+
+    pthread_t threads[READERS];
+    atomic_store(&done, false);
+    for (int i = 0; i < READERS; i++) {
+        pthread_create(&threads[i], NULL, reader, t);
+    }
+
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int k = 1; k < N; k += 2) {
+            table_insert(t, new_int(k), new_int(k));
+        }
+        for (int k = round % 2; k < N; k += 2) {
+            // Replace even keys and remove odd ones.
+            if (k % 2 == 0) {
+                table_insert(t, new_int(k), new_int(k));
+            } else {
+                table_remove(t, &k);
+            }
+        }
+        if (round % 2 == 0) {
+            for (int k = 1; k < N; k += 2) {
+                table_remove(t, &k);
+            }
+        }
+    }
+
+    atomic_store(&done, true);
+    for (int i = 0; i < READERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    table_kill(t);
+    check_ints_killed();
+
+    fprintf(stderr, "Test succeeded: the readers saw consistent tables.\n");
+}
+
+// Keys of choose_test(). They are not killed, so a reader may read a
+// returned key after the writer has removed it.
+static int choose_keys[N];
+
+/**
+ * chooser() - Call table_choose_key() until the writer is done.
+ * @arg: The table.
+ *
+ * Returns: NULL.
+ */
+static void *chooser(void *arg)
+{
+    table *t = arg;
+
+    while (!atomic_load(&done)) {
+        int *k = table_choose_key(t);
+        if (k != NULL && (k < choose_keys || k >= choose_keys + N)) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: table_choose_key returned a pointer that is not a key.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * choose_test() - Test table_choose_key() concurrently with a writer.
+ *
+ * The writer fills the table and removes the keys from the smallest
+ * one, which is the node table_choose_key() reads, until the table is
+ * empty, while READERS threads run chooser(). Compiled with
+ * -fsanitize=address, a node freed while a chooser reads it is
+ * detected.
+ */
+void choose_test(void)
+{
+    fprintf(stderr, "Starting choose_test()...");
+
+    table *t = table_empty(compare_int, NULL, NULL);
+    pthread_t threads[READERS];
+
+    for (int k = 0; k < N; k++) {
+        choose_keys[k] = k;
+    }
+    atomic_store(&done, false);
+    for (int i = 0; i < READERS; i++) {
+        pthread_create(&threads[i], NULL, chooser, t);
+    }
+
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int k = 0; k < N; k++) {
+            table_insert(t, &choose_keys[k], &choose_keys[k]);
+        }
+        for (int k = 0; k < N; k++) {
+            table_remove(t, &choose_keys[k]);
+        }
+    }
+
+    atomic_store(&done, true);
+    for (int i = 0; i < READERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    table_kill(t);
+
+    fprintf(stderr, "Test succeeded: table_choose_key saw only present or no keys.\n");
+}
+
+/**
+ * immediate_kill_test() - Test that kills are not deferred without readers.
+ *
+ * Without concurrent readers, table_remove() and table_insert() must
+ * call the kill functions before they return, as the other tables do.
+ */
+void immediate_kill_test(void)
+{
+    fprintf(stderr, "Starting immediate_kill_test()...");
+
+    table *t = table_empty(compare_int, kill_int, kill_int);
+    int k = 7;
+
+    ints_killed = 0;
+    table_insert(t, new_int(7), new_int(7));
+    table_insert(t, new_int(7), new_int(70));
+    if (ints_killed != 2) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: replacing a key killed %ld keys and values, expected 2.\n",
+                ints_killed);
+        exit(EXIT_FAILURE);
+    }
+    table_remove(t, &k);
+    if (ints_killed != 4 || !table_is_empty(t)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: removing a key killed %ld keys and values, expected 4.\n",
+                ints_killed);
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    fprintf(stderr, "Test succeeded: the kill functions were called at once.\n");
+}
+
+int main(void)
+{
+    concurrent_test();      // Test concurrent readers
+    choose_test();          // Test table_choose_key with a writer
+    immediate_kill_test();  // Test kills without readers
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
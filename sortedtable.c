@@ -0,0 +1,740 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h> // For isspace()
+#include <stdarg.h>
+
+#include <table.h>
+
+#include "table_ext.h"
+
+// Initial number of slots in the entry array.
+#define INITIAL_SIZE 16
+
+/*
+ * Implementation of a generic table for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The table is an array of key/value pairs kept sorted by the key
+ * compare function, which must define a total order, not only
+ * equality. table_lookup() and table_remove() use binary search, so
+ * they are O(log n). table_insert() and table_remove() move the
+ * entries after the position with memmove(), which is O(n) but a
+ * single pass over contiguous memory. The table suits read-mostly
+ * use; a table that is built once and then searched is best built
+ * by inserting the keys in ascending order, which moves no entries.
+ *
+ * The entries are stored by value, not as pointers to allocated
+ * entries, so a search touches only the array and the keys. The array
+ * is doubled with realloc() when full; unlike in arraytable.c no
+ * incremental migration is needed, since an insert already costs
+ * O(n) moves.
+ *
+ * Inserting a key that is already in the table replaces its key and
+ * value, so the table holds no duplicates. table_lookup() thus returns
+ * the latest inserted value and table_remove() removes the key, as
+ * table.h requires.
+ *
+ * table_range() from table_ext.h visits the entries between two keys
+ * in ascending order. table_print() and table_print_internal() also
+ * print in ascending order.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version, based on arraytable.c v2.2.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct table_entry {
+    void *key;
+    void *value;
+} table_entry;
+
+struct table {
+    table_entry *entries; // Entries sorted by key
+    int size; // Number of entries
+    int capacity; // Number of slots in entries
+    compare_function *key_cmp_func;
+    kill_function key_kill_func;
+    kill_function value_kill_func;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * lower_bound() - Find the position of a key.
+ * @t: Table to inspect.
+ * @key: Key to search for.
+ *
+ * Returns: The index of the first entry whose key is not less than
+ * key, or t->size if there is no such entry.
+ */
+static int lower_bound(const table *t, const void *key)
+{
+    int lo = 0;
+    int hi = t->size;
+
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (t->key_cmp_func(t->entries[mid].key, key) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Internal function to check if the entry at index i has the given key.
+static bool match_at(const table *t, int i, const void *key)
+{
+    return i < t->size && t->key_cmp_func(t->entries[i].key, key) == 0;
+}
+
+/**
+ * insert_at() - Insert a new entry at a given index.
+ * @t: Table to manipulate.
+ * @i: Index of the new entry, from 0 to t->size.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Returns: Nothing.
+ */
+static void insert_at(table *t, int i, void *key, void *value)
+{
+    if (t->size == t->capacity) {
+        t->capacity *= 2;
+        t->entries = realloc(t->entries, t->capacity * sizeof(table_entry));
+    }
+    // Open a gap at index i.
+    memmove(&t->entries[i + 1], &t->entries[i], (t->size - i) * sizeof(table_entry));
+    t->entries[i].key = key;
+    t->entries[i].value = value;
+    t->size++;
+}
+
+// ==========INTERFACE==========
+
+/**
+ * table_empty() - Create an empty table.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ *                Must return a negative, zero or positive value, as
+ *                for qsort().
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty(compare_function *key_cmp_func,
+                   kill_function key_kill_func,
+                   kill_function value_kill_func)
+{
+    // Allocate memory for the table head.
+    table *t = calloc(1, sizeof(table));
+
+    t->entries = malloc(INITIAL_SIZE * sizeof(table_entry));
+    t->capacity = INITIAL_SIZE;
+    t->size = 0;
+
+    // Store the key compare function and key/value kill functions.
+    t->key_cmp_func = key_cmp_func;
+    t->key_kill_func = key_kill_func;
+    t->value_kill_func = value_kill_func;
+
+    return t;
+}
+
+/**
+ * table_is_empty() - Check if a table is empty.
+ * @table: Table to check.
+ *
+ * Returns: True if table contains no key/value pairs, false otherwise.
+ */
+bool table_is_empty(const table *t)
+{
+    return t->size == 0;
+}
+
+/**
+ * table_insert() - Add a key/value pair to a table.
+ * @table: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Insert the key/value pair into the table. If the key is already in
+ * the table, its old key and value are de-allocated with the kill
+ * functions and replaced.
+ *
+ * Returns: Nothing.
+ */
+void table_insert(table *t, void *key, void *value)
+{
+    int i = lower_bound(t, key);
+
+    if (match_at(t, i, key)) {
+        table_entry *e = &t->entries[i];
+        if (t->key_kill_func != NULL && e->key != key) {
+            t->key_kill_func(e->key);
+        }
+        if (t->value_kill_func != NULL && e->value != value) {
+            t->value_kill_func(e->value);
+        }
+        e->key = key;
+        e->value = value;
+        return;
+    }
+    insert_at(t, i, key, value);
+}
+
+/**
+ * table_lookup() - Look up a given key in a table.
+ * @table: Table to inspect.
+ * @key: Key to look up.
+ *
+ * Returns: The value corresponding to a given key, or NULL if the key
+ * is not found in the table.
+ */
+void *table_lookup(const table *t, const void *key)
+{
+    int i = lower_bound(t, key);
+
+    if (match_at(t, i, key)) {
+        return t->entries[i].value;
+    }
+    return NULL;
+}
+
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * See table_ext.h. An absent key is inserted at the position found by
+ * the search.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx)
+{
+    int i = lower_bound(t, key);
+
+    if (match_at(t, i, key)) {
+        table_entry *e = &t->entries[i];
+        void *value = fn(e->value, true, ctx);
+        if (value != e->value && t->value_kill_func != NULL) {
+            t->value_kill_func(e->value);
+        }
+        e->value = value;
+        return value;
+    }
+
+    void *value = fn(NULL, false, ctx);
+    if (value != NULL) {
+        insert_at(t, i, key, value);
+    }
+    return value;
+}
+
+/**
+ * table_range() - Visit the entries between two keys in order.
+ * @t: Table to inspect.
+ * @lo: Lowest key to visit, or NULL to start at the smallest key.
+ * @hi: Highest key to visit, or NULL to end at the largest key.
+ * @callback: Function called for each entry.
+ * @ctx: Context pointer passed on to callback.
+ *
+ * See table_ext.h. The first entry is found by binary search and the
+ * rest are read in sequence.
+ *
+ * Returns: The number of visited entries.
+ */
+int table_range(const table *t, const void *lo, const void *hi,
+                range_callback *callback, void *ctx)
+{
+    int i = lo != NULL ? lower_bound(t, lo) : 0;
+    int n = 0;
+
+    while (i < t->size && (hi == NULL || t->key_cmp_func(t->entries[i].key, hi) <= 0)) {
+        callback(t->entries[i].key, t->entries[i].value, ctx);
+        i++;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * table_choose_key() - Return an arbitrary key.
+ * @t: Table to inspect.
+ *
+ * Return an arbitrary key stored in the table. Can be used together
+ * with table_remove() to deconstruct the table. Undefined for an
+ * empty table.
+ *
+ * Returns: The largest key, since removing it moves no entries.
+ */
+void *table_choose_key(const table *t)
+{
+    return t->entries[t->size - 1].key;
+}
+
+/**
+ * table_remove() - Remove a key/value pair in the table.
+ * @table: Table to manipulate.
+ * @key: Key for which to remove pair.
+ *
+ * Will call any kill functions set for keys/values. Does nothing if
+ * key is not found in the table.
+ *
+ * Returns: Nothing.
+ */
+void table_remove(table *t, const void *key)
+{
+    int i = lower_bound(t, key);
+
+    if (!match_at(t, i, key)) {
+        return;
+    }
+
+    table_entry e = t->entries[i];
+
+    // Close the gap before calling the kill functions, since key may
+    // point to the same memory as the stored key.
+    memmove(&t->entries[i], &t->entries[i + 1], (t->size - i - 1) * sizeof(table_entry));
+    t->size--;
+
+    if (t->key_kill_func != NULL) {
+        t->key_kill_func(e.key);
+    }
+    if (t->value_kill_func != NULL) {
+        t->value_kill_func(e.value);
+    }
+}
+
+/*
+ * table_kill() - Destroy a table.
+ * @table: Table to destroy.
+ *
+ * Return all dynamic memory used by the table and its elements. If a
+ * kill_func was registered for keys and/or values at table creation,
+ * it is called each element to kill any user-allocated memory
+ * occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void table_kill(table *t)
+{
+    for (int i = 0; i < t->size; i++) {
+        if (t->key_kill_func != NULL) {
+            t->key_kill_func(t->entries[i].key);
+        }
+        if (t->value_kill_func != NULL) {
+            t->value_kill_func(t->entries[i].value);
+        }
+    }
+    free(t->entries);
+    free(t);
+}
+
+/**
+ * table_print() - Print the given table.
+ * @t: Table to print.
+ * @print_func: Function called for each key/value pair in the table.
+ *
+ * Iterates over the key/value pairs in the table in ascending key
+ * order and prints them.
+ *
+ * Returns: Nothing.
+ */
+void table_print(const table *t, inspect_callback_pair print_func)
+{
+    for (int i = 0; i < t->size; i++) {
+        print_func(t->entries[i].key, t->entries[i].value);
+    }
+}
+
+// ===========INTERNAL FUNCTIONS USED BY table_print_internal ============
+
+// The functions below output code in the dot language, used by
+// GraphViz. For documention of the dot language, see graphviz.org.
+
+/**
+ * indent() - Output indentation string.
+ * @n: Indentation level.
+ *
+ * Print n tab characters.
+ *
+ * Returns: Nothing.
+ */
+static void indent(int n)
+{
+    for (int i=0; i<n; i++) {
+        printf("\t");
+    }
+}
+
+/**
+ * iprintf(...) - Indent and print.
+ * @n: Indentation level
+ * @...: printf arguments
+ *
+ * Print n tab characters and calls printf.
+ *
+ * Returns: Nothing.
+ */
+static void iprintf(int n, const char *fmt, ...)
+{
+    // Indent...
+    indent(n);
+    // ...and call printf
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * print_edge() - Print a edge between two addresses.
+ * @from: The address of the start of the edge. Should be non-NULL.
+ * @to: The address of the destination for the edge, including NULL.
+ * @port: The name of the port on the source node, or NULL.
+ * @label: The label for the edge, or NULL.
+ * @options: A string with other edge options, or NULL.
+ *
+ * Print an edge from port PORT on node FROM to TO with label
+ * LABEL. If to is NULL, the destination is the NULL node, otherwise a
+ * memory node. If the port is NULL, the edge starts at the node, not
+ * a specific port on it. If label is NULL, no label is used. The
+ * options string, if non-NULL, is printed before the label.
+ *
+ * Returns: Nothing.
+ */
+static void print_edge(int indent_level, const void *from, const void *to, const char *port,
+                       const char *label, const char *options)
+{
+    indent(indent_level);
+    if (port) {
+        printf("m%04lx:%s -> ", PTR2ADDR(from), port);
+    } else {
+        printf("m%04lx -> ", PTR2ADDR(from));
+    }
+    if (to == NULL) {
+        printf("NULL");
+    } else {
+        printf("m%04lx", PTR2ADDR(to));
+    }
+    printf(" [");
+    if (options != NULL) {
+        printf("%s", options);
+    }
+    if (label != NULL) {
+        printf(" label=\"%s\"",label);
+    }
+    printf("]\n");
+}
+
+/**
+ * print_head_node() - Print a node corresponding to the table struct.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ *
+ * Returns: Nothing.
+ */
+static void print_head_node(int indent_level, const table *t)
+{
+    iprintf(indent_level, "m%04lx [shape=record "
+            "label=\"entries\\n%04lx|size\\n%d|capacity\\n%d|cmp\\n%04lx|key_kill\\n%04lx"
+            "|value_kill\\n%04lx\"]\n",
+            PTR2ADDR(t), PTR2ADDR(t->entries), t->size, t->capacity,
+            PTR2ADDR(t->key_cmp_func), PTR2ADDR(t->key_kill_func),
+            PTR2ADDR(t->value_kill_func));
+}
+
+// Internal function to print the key and value nodes in dot format.
+static void print_key_value_nodes(int indent_level, const void *key, const void *value,
+                                  inspect_callback key_print_func,
+                                  inspect_callback value_print_func)
+{
+    if (key != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(key));
+        if (key_print_func != NULL) {
+            key_print_func(key);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(key));
+    }
+    if (value != NULL) {
+        iprintf(indent_level, "m%04lx [label=\"", PTR2ADDR(value));
+        if (value_print_func != NULL) {
+            value_print_func(value);
+        }
+        printf("\" xlabel=\"%04lx\"]\n", PTR2ADDR(value));
+    }
+}
+
+/**
+ * print_entry() - Print one entry in dot format.
+ * @indent_level: Indentation level.
+ * @t: Table to inspect.
+ * @e: Address of the entry, used as the name of its node.
+ * @i: Position of the entry in the printout.
+ * @key: Key of the entry.
+ * @value: Value of the entry.
+ * @key_print_func: Function called for the key.
+ * @value_print_func: Function called for the value.
+ * @payload: If true, print the key and value nodes, otherwise the
+ *           entry node and its edges.
+ *
+ * The entry is drawn as an edge from the head node labelled with its
+ * position. Memory "owned" by the table is indicated by solid red
+ * lines. Memory "borrowed" from the user is indicated by red dashed
+ * lines.
+ *
+ * Returns: Nothing.
+ */
+static void print_entry(int indent_level, const table *t, const void *e, int i,
+                        const void *key, const void *value,
+                        inspect_callback key_print_func,
+                        inspect_callback value_print_func, bool payload)
+{
+    if (payload) {
+        print_key_value_nodes(indent_level, key, value, key_print_func, value_print_func);
+        return;
+    }
+    char label[16];
+    snprintf(label, sizeof(label), "%d", i);
+
+    iprintf(indent_level, "m%04lx [shape=record label=\"<k>key\\n%04lx|<v>value\\n%04lx\"]\n",
+            PTR2ADDR(e), PTR2ADDR(key), PTR2ADDR(value));
+    print_edge(indent_level, t, e, NULL, label, NULL);
+    if (key == NULL) {
+        print_edge(indent_level, e, key, "k", "key", NULL);
+    } else if (t->key_kill_func) {
+        print_edge(indent_level, e, key, "k", "key", "color=red");
+    } else {
+        print_edge(indent_level, e, key, "k", "key", "color=red style=dashed");
+    }
+    if (value == NULL) {
+        print_edge(indent_level, e, value, "v", "value", NULL);
+    } else if (t->value_kill_func) {
+        print_edge(indent_level, e, value, "v", "value", "color=red");
+    } else {
+        print_edge(indent_level, e, value, "v", "value", "color=red style=dashed");
+    }
+}
+
+// Internal function to print all entries in ascending key order in dot format.
+static void print_entries(int indent_level, const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, bool payload)
+{
+    for (int i = 0; i < t->size; i++) {
+        print_entry(indent_level, t, &t->entries[i], i, t->entries[i].key,
+                    t->entries[i].value, key_print_func, value_print_func, payload);
+    }
+}
+
+// Create an escaped version of the input string. The most common
+// control characters - newline, horizontal tab, backslash, and double
+// quote - are replaced by their escape sequence. The returned pointer
+// must be deallocated by the caller.
+static char *escape_chars(const char *s)
+{
+    int i, j;
+    int escaped = 0; // The number of chars that must be escaped.
+
+    // Count how many chars need to be escaped, i.e. how much longer
+    // the output string will be.
+    for (i = escaped = 0; s[i] != '\0'; i++) {
+        if (s[i] == '\n' || s[i] == '\t' || s[i] == '\\' || s[i] == '\"') {
+            escaped++;
+        }
+    }
+    // Allocate space for the escaped string. The variable i holds the input
+    // length, escaped how much the string will grow.
+    char *t = malloc(i + escaped + 1);
+
+    // Copy-and-escape loop
+    for (i = j = 0; s[i] != '\0'; i++) {
+        // Convert each control character by its escape sequence.
+        // Non-control characters are copied as-is.
+        switch (s[i]) {
+        case '\n': t[i+j] = '\\'; t[i+j+1] = 'n';  j++; break;
+        case '\t': t[i+j] = '\\'; t[i+j+1] = 't';  j++; break;
+        case '\\': t[i+j] = '\\'; t[i+j+1] = '\\'; j++; break;
+        case '\"': t[i+j] = '\\'; t[i+j+1] = '\"'; j++; break;
+        default:   t[i+j] = s[i]; break;
+        }
+    }
+    // Terminal the output string
+    t[i+j] = '\0';
+    return t;
+}
+
+/**
+ * first_white_spc() - Return pointer to first white-space char.
+ * @s: String.
+ *
+ * Returns: A pointer to the first white-space char in s, or NULL if none is found.
+ *
+ */
+static const char *find_white_spc(const char *s)
+{
+    const char *t = s;
+    while (*t != '\0') {
+        if (isspace(*t)) {
+            // We found a white-space char, return a point to it.
+            return t;
+        }
+        // Advance to next char
+        t++;
+    }
+    // No white-space found
+    return NULL;
+}
+
+/**
+ * insert_table_name() - Maybe insert the name of the table src file in the description string.
+ * @s: Description string.
+ *
+ * Parses the description string to find of if it starts with a c file
+ * name. In that case, the file name of this file is spliced into the
+ * description string. The parsing is not very intelligent: If the
+ * sequence ".c:" (case insensitive) is found before the first
+ * white-space, the string up to and including ".c" is taken to be a c
+ * file name.
+ *
+ * Returns: A dynamic copy of s, optionally including with the table src file name.
+ */
+static char *insert_table_name(const char *s)
+{
+    // First, determine if the description string starts with a c file name
+    // a) Search for the string ".c:"
+    const char *dot_c = strstr(s, ".c:");
+    // b) Search for the first white-space
+    const char *spc = find_white_spc(s);
+
+    bool prefix_found;
+    int output_length;
+
+    // If both a) and b) are found AND a) is before b, we assume that
+    // s starts with a file name
+    if (dot_c != NULL && spc != NULL && dot_c < spc) {
+        // We found a match. Output string is input + 3 chars + __FILE__
+        prefix_found = true;
+        output_length = strlen(s) + 3 + strlen(__FILE__);
+    } else {
+        // No match found. Output string is just input
+        prefix_found = false;
+        output_length = strlen(s);
+    }
+
+    // Allocate space for the whole string
+    char *out = calloc(1, output_length + 1);
+    strcpy(out, s);
+    if (prefix_found) {
+        // Overwrite the output buffer from the ":"
+        strcpy(out + (dot_c - s + 2), " (");
+        // Now out will be 0-terminated after "(", append the file name and ")"
+        strcat(out, __FILE__);
+        strcat(out, ")");
+        // Finally append the input string from the : onwards
+        strcat(out, dot_c + 2);
+    }
+    return out;
+}
+
+/**
+ * table_print_internal() - Output the internal structure of the table.
+ * @t: Table to print.
+ * @key_print_func: Function called for each key in the table.
+ * @value_print_func: Function called for each value in the table.
+ * @desc: String with a description/state of the list.
+ * @indent_level: Indentation level, 0 for outermost
+ *
+ * Prints code that shows the entries of the array in ascending key
+ * order, each as an edge from the table struct labelled with its
+ * index.
+ *
+ * Returns: Nothing.
+ */
+void table_print_internal(const table *t, inspect_callback key_print_func,
+                          inspect_callback value_print_func, const char *desc,
+                          int indent_level)
+{
+    static int graph_number = 0;
+    graph_number++;
+    int il = indent_level;
+
+    if (indent_level == 0) {
+        // If this is the outermost datatype, start a graph and set up defaults
+        printf("digraph TABLE_%d {\n", graph_number);
+
+        // Specify default shape and fontname
+        il++;
+        iprintf(il, "node [shape=rectangle fontname=\"Courier New\"]\n");
+        iprintf(il, "ranksep=0.01\n");
+        iprintf(il, "subgraph cluster_nullspace {\n");
+        iprintf(il+1, "NULL\n");
+        iprintf(il, "}\n");
+    }
+
+    if (desc != NULL) {
+        // Escape the string before printout
+        char *escaped = escape_chars(desc);
+        // Optionally, splice the source file name
+        char *spliced = insert_table_name(escaped);
+
+        // Use different names on inner description nodes
+        if (indent_level == 0) {
+            iprintf(il, "description [label=\"%s\"]\n", spliced);
+        } else {
+            iprintf(il, "\tcluster_list_%d_description [label=\"%s\"]\n", graph_number, spliced);
+        }
+        // Return the memory used by the spliced and escaped strings
+        free(spliced);
+        free(escaped);
+    }
+
+    if (indent_level == 0) {
+        // Use a single "pointer" edge as a starting point for the
+        // outermost datatype
+        iprintf(il, "t [label=\"%04lx\" xlabel=\"t\"]\n", PTR2ADDR(t));
+        iprintf(il, "t -> m%04lx\n", PTR2ADDR(t));
+    }
+
+    if (indent_level == 0) {
+        // Put the user nodes in userspace
+        iprintf(il, "subgraph cluster_userspace { label=\"User space\"\n");
+        il++;
+
+        // Print the key and value nodes
+        print_entries(il, t, key_print_func, value_print_func, true);
+
+        // Close the subgraph
+        il--;
+        iprintf(il, "}\n");
+    }
+
+    // Print the subgraph to surround the table content
+    iprintf(il, "subgraph cluster_table_%d { label=\"Table\"\n", graph_number);
+    il++;
+
+    // Output the head node
+    print_head_node(il, t);
+
+    // Output the entries and their edges
+    print_entries(il, t, key_print_func, value_print_func, false);
+
+    // Close the subgraph
+    il--;
+    iprintf(il, "}\n");
+
+    if (indent_level == 0) {
+        // Termination of graph
+        printf("}\n");
+    }
+}
@@ -0,0 +1,310 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "bench_clock.h"
+#include "stack.h"
+#include "lfstack.h"
+#include "histogram.h"
+#include "perf_counters.h"
+
+/**
+ * stack_bench.c - Benchmarks for the generic stack implementations.
+ *
+ * The program is linked with one implementation of stack.h, e.g.
+ * chunkstack.c or the list-based stack.c:
+ *
+ *   gcc -std=c11 -O2 -pthread -I<include> -DSTACK_BACKEND='"chunkstack"' \
+ *       stack_bench.c chunkstack.c arena.c lfstack.c histogram.c perf_counters.c \
+ *       bench_clock.c
+ *
+ * Usage: stack_bench [n] [threads]
+ *
+ * Runs n (default 10^7) pushes followed by n pops, and n alternating
+ * push/pop pairs on a non-empty stack, and prints the throughput of
+ * each workload. No kill function is used, so only the stack itself
+ * is measured.
+ *
+ * The latency workload pushes n elements, inspects the top n times and
+ * pops them all, timing every operation, and prints p50, p90, p99,
+ * p99.9 and the maximum latency of each operation.
+ *
+ * The scaling workload runs n push/pop pairs on one shared stack,
+ * split over 1, 2, 4, ... up to threads threads (default: the number
+ * of online cores). It compares the stack.h stack wrapped in a mutex
+ * with the lock-free stack in lfstack.h.
+ *
+ * The single-threaded workloads also print the hardware counters of
+ * perf_counters.h per operation: cycles, instructions, cache, TLB and
+ * branch misses. Where the counters are unavailable, e.g. in most
+ * containers, "counters=n/a" is printed instead.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version with push/pop throughput.
+ * 2026-10-18 v1.1: Added the thread scaling workload.
+ * 2026-10-18 v1.2: Added hardware counters.
+ * 2026-10-18 v1.3: Added the latency workload.
+ * 2026-10-18 v1.4: Clock helpers moved to bench_clock.c.
+ */
+
+#ifndef STACK_BACKEND
+#define STACK_BACKEND "stack"
+#endif
+
+#define DEFAULT_N 10000000
+
+// Counters of the main thread, opened by main().
+static perf_counters *counters;
+
+// Internal function to print the result of one workload.
+static void report(const char *workload, long n, long long ns,
+                   const long long values[PERF_NUM_COUNTERS])
+{
+    char buf[256];
+
+    printf("%s: %-8s n=%ld %.2f ns/op %.1f Mops/s %s\n", STACK_BACKEND, workload, n,
+           (double)ns / n, n * 1e3 / ns, perf_counters_format(values, n, buf, sizeof(buf)));
+}
+
+/**
+ * push_pop_bench() - Measure push and pop throughput.
+ * @n: Number of elements to push and pop.
+ *
+ * Pushes n elements on an empty stack, then pops them all.
+ *
+ * Returns: Nothing.
+ */
+static void push_pop_bench(long n)
+{
+    static int value;
+    long long push_values[PERF_NUM_COUNTERS];
+    long long pop_values[PERF_NUM_COUNTERS];
+    stack *s = stack_empty(NULL);
+
+    perf_counters_start(counters);
+    long long start = now_ns();
+    for (long i = 0; i < n; i++) {
+        s = stack_push(s, &value);
+    }
+    long long mid = now_ns();
+    perf_counters_stop(counters, push_values);
+    perf_counters_start(counters);
+    long long mid2 = now_ns();
+    for (long i = 0; i < n; i++) {
+        s = stack_pop(s);
+    }
+    long long end = now_ns();
+    perf_counters_stop(counters, pop_values);
+
+    report("push", n, mid - start, push_values);
+    report("pop", n, end - mid2, pop_values);
+
+    stack_kill(s);
+}
+
+/**
+ * mixed_bench() - Measure alternating push/pop throughput.
+ * @n: Number of push/pop pairs.
+ *
+ * Alternates push, top and pop on a stack holding a few elements,
+ * the typical pattern of a parser or search loop.
+ *
+ * Returns: Nothing.
+ */
+static void mixed_bench(long n)
+{
+    static int value;
+    stack *s = stack_empty(NULL);
+    long sum = 0;
+
+    for (int i = 0; i < 10; i++) {
+        s = stack_push(s, &value);
+    }
+
+    long long values[PERF_NUM_COUNTERS];
+    perf_counters_start(counters);
+    long long start = now_ns();
+    for (long i = 0; i < n; i++) {
+        s = stack_push(s, &value);
+        sum += stack_top(s) == &value;
+        s = stack_pop(s);
+    }
+    long long end = now_ns();
+    perf_counters_stop(counters, values);
+
+    report("push/pop", n, end - start, values);
+    if (sum != n) {
+        fprintf(stderr, "FAIL: stack_top returned wrong element\n");
+        exit(EXIT_FAILURE);
+    }
+
+    stack_kill(s);
+}
+
+/**
+ * latency_bench() - Measure the latency of single stack operations.
+ * @n: Number of elements to push, inspect and pop.
+ *
+ * Returns: Nothing.
+ */
+static void latency_bench(long n)
+{
+    static int value;
+    const char *ops[3] = { "push", "top", "pop" };
+    histogram *h[3] = { histogram_empty(), histogram_empty(), histogram_empty() };
+    long long overhead = clock_overhead();
+    long sum = 0;
+    stack *s = stack_empty(NULL);
+
+    for (long i = 0; i < n; i++) {
+        long long start = now_ns();
+        s = stack_push(s, &value);
+        histogram_record(h[0], now_ns() - start - overhead);
+    }
+    for (long i = 0; i < n; i++) {
+        long long start = now_ns();
+        sum += stack_top(s) == &value;
+        histogram_record(h[1], now_ns() - start - overhead);
+    }
+    for (long i = 0; i < n; i++) {
+        long long start = now_ns();
+        s = stack_pop(s);
+        histogram_record(h[2], now_ns() - start - overhead);
+    }
+
+    for (int op = 0; op < 3; op++) {
+        char buf[256];
+        printf("%s: latency %-4s n=%ld %s ns\n", STACK_BACKEND, ops[op], n,
+               histogram_format(h[op], buf, sizeof(buf)));
+        histogram_kill(h[op]);
+    }
+    if (sum != n) {
+        fprintf(stderr, "FAIL: stack_top returned wrong element\n");
+        exit(EXIT_FAILURE);
+    }
+
+    stack_kill(s);
+}
+
+// Shared state for the scaling workload.
+typedef struct scaling_arg {
+    stack *s; // Stack wrapped by lock, or NULL
+    pthread_mutex_t *lock;
+    lfstack *lf; // Lock-free stack, or NULL
+    long n; // Number of push/pop pairs for this thread
+} scaling_arg;
+
+// Thread function for the scaling workload.
+static void *scaling_thread(void *p)
+{
+    static int value;
+    scaling_arg *a = p;
+
+    for (long i = 0; i < a->n; i++) {
+        if (a->lf != NULL) {
+            lfstack_push(a->lf, &value);
+            lfstack_pop(a->lf);
+        } else {
+            pthread_mutex_lock(a->lock);
+            a->s = stack_push(a->s, &value);
+            pthread_mutex_unlock(a->lock);
+            pthread_mutex_lock(a->lock);
+            a->s = stack_pop(a->s);
+            pthread_mutex_unlock(a->lock);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * scaling_run() - Run the scaling workload with a given number of threads.
+ * @n: Total number of push/pop pairs.
+ * @threads: Number of threads.
+ * @lock_free: If true, use the lock-free stack, otherwise the mutex-wrapped stack.
+ *
+ * Returns: The elapsed time in nanoseconds.
+ */
+static long long scaling_run(long n, int threads, bool lock_free)
+{
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    stack *s = stack_empty(NULL);
+    lfstack *lf = lfstack_empty(NULL);
+    pthread_t *tid = malloc(threads * sizeof(*tid));
+    scaling_arg *args = malloc(threads * sizeof(*args));
+
+    long long start = now_ns();
+    for (int t = 0; t < threads; t++) {
+        // All threads share the stack and the lock through s.
+        args[t] = (scaling_arg) { s, &lock, lock_free ? lf : NULL, n / threads };
+        pthread_create(&tid[t], NULL, scaling_thread, &args[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tid[t], NULL);
+    }
+    long long ns = now_ns() - start;
+
+    stack_kill(s);
+    lfstack_kill(lf);
+    free(tid);
+    free(args);
+    return ns;
+}
+
+/**
+ * scaling_bench() - Compare the mutex-wrapped and lock-free stacks.
+ * @n: Total number of push/pop pairs per run.
+ * @max_threads: Largest number of threads.
+ *
+ * Returns: Nothing.
+ */
+static void scaling_bench(long n, int max_threads)
+{
+    int threads = 1;
+
+    while (threads <= max_threads) {
+        long pairs = n / threads * threads;
+        long long mutex_ns = scaling_run(n, threads, false);
+        long long lf_ns = scaling_run(n, threads, true);
+
+        printf("%s: scaling threads=%d mutex %.2f ns/pair %.1f Mpairs/s, "
+               "lock-free %.2f ns/pair %.1f Mpairs/s\n", STACK_BACKEND, threads,
+               (double)mutex_ns / pairs, pairs * 1e3 / mutex_ns,
+               (double)lf_ns / pairs, pairs * 1e3 / lf_ns);
+        // Double the number of threads, but always include max_threads itself.
+        if (threads < max_threads && threads * 2 > max_threads) {
+            threads = max_threads;
+        } else {
+            threads *= 2;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    long n = DEFAULT_N;
+    int threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (argc > 1) {
+        n = atol(argv[1]);
+    }
+    if (argc > 2) {
+        threads = atoi(argv[2]);
+    }
+    if (n <= 0 || threads <= 0) {
+        fprintf(stderr, "Usage: %s [n] [threads]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    counters = perf_counters_open();
+    push_pop_bench(n);
+    mixed_bench(n);
+    perf_counters_close(counters);
+    latency_bench(n);
+    scaling_bench(n, threads);
+
+    return 0;
+}
@@ -0,0 +1,354 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "alloc_track.h"
+#include "bench_clock.h"
+
+/**
+ * stack_suite.c - Benchmark suite for the stacks, with CSV output.
+ *
+ * stack.h and int_stack.h declare the same function names, so the
+ * suite is built once per stack, selected with a macro:
+ *
+ *   gcc -O2 -I<include> stack_suite.c alloc_track.c bench_clock.c stack.c -ldl  # stack.h
+ *   gcc ... -DSUITE_INT_STACK stack_suite.c alloc_track.c bench_clock.c \
+ *       int_stack.c -ldl                                          # int_stack.h
+ *   gcc ... -DSUITE_INT_DSTACK stack_suite.c alloc_track.c bench_clock.c \
+ *       int_dstack.c int_scan.c -ldl                              # int_dstack.h
+ *
+ * Any implementation of stack.h can be used, e.g. chunkstack.c; name
+ * it with -DSTACK_BACKEND='"chunkstack"' as for stack_bench.c. The
+ * allocations are counted by alloc_track.c, as in alloc_bench.c.
+ *
+ * Usage: stack_suite [max_depth]
+ *
+ * For each depth 10, 100, ... up to max_depth (default 10^7, at most
+ * MAX_STACK_SIZE for int_stack.h), the suite pushes depth elements,
+ * inspects the top depth times and pops all elements, repeating the
+ * cycle until at least MIN_OPS operations of each kind have run. For
+ * each operation it prints one CSV line with
+ *  - ns_per_op:     mean time from the throughput run,
+ *  - allocs_per_op: malloc/calloc/realloc calls per operation,
+ *  - bytes_per_op:  bytes allocated per operation,
+ *  - peak_live_bytes: largest number of bytes allocated by the stack
+ *                   and not yet freed,
+ *  - peak_rss_kb:   growth of the peak resident set size during the
+ *                   run (Linux only, otherwise -1). Memory that malloc
+ *                   kept from a smaller depth is not counted again,
+ *  - p50_ns..max_ns: latency percentiles from a separate run where
+ *                   single operations are timed, minus the overhead
+ *                   of reading the clock.
+ * The first line is a header; concatenate the runs of several builds
+ * with tail -n +2.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Clock helpers moved to bench_clock.c.
+ * 2026-10-18 v1.2: Allocations counted by alloc_track.c, with bytes and peak live bytes.
+ */
+
+// ==========BACKEND SELECTION==========
+
+// Each backend defines its name, its largest depth and macros for
+// the stack operations. SUITE_TOP evaluates to a long so the results
+// can be accumulated and checked.
+#if defined(SUITE_INT_STACK)
+
+#include "int_stack.h"
+#define BACKEND "int_stack"
+#define BACKEND_MAX_DEPTH MAX_STACK_SIZE
+typedef stack suite_stack;
+#define SUITE_EMPTY() stack_empty()
+#define SUITE_PUSH(s, v) ((s) = stack_push((s), (v)))
+#define SUITE_TOP(s) ((long)stack_top(s))
+#define SUITE_POP(s) ((s) = stack_pop(s))
+#define SUITE_KILL(s) ((void)(s))
+
+#elif defined(SUITE_INT_DSTACK)
+
+#include "int_dstack.h"
+#define BACKEND "int_dstack"
+#define BACKEND_MAX_DEPTH 10000000
+typedef int_dstack *suite_stack;
+#define SUITE_EMPTY() int_dstack_empty()
+#define SUITE_PUSH(s, v) ((s) = int_dstack_push((s), (v)))
+#define SUITE_TOP(s) ((long)int_dstack_top(s))
+#define SUITE_POP(s) ((s) = int_dstack_pop(s))
+#define SUITE_KILL(s) int_dstack_kill(s)
+
+#else
+
+#include "stack.h"
+#ifndef STACK_BACKEND
+#define STACK_BACKEND "stack"
+#endif
+#define BACKEND STACK_BACKEND
+#define BACKEND_MAX_DEPTH 10000000
+typedef stack *suite_stack;
+// The elements are not owned by the stack, so only the stack itself
+// is measured.
+static int values[2];
+#define SUITE_EMPTY() stack_empty(NULL)
+#define SUITE_PUSH(s, v) ((s) = stack_push((s), &values[(v) & 1]))
+#define SUITE_TOP(s) ((long)((int *)stack_top(s) - values))
+#define SUITE_POP(s) ((s) = stack_pop(s))
+#define SUITE_KILL(s) stack_kill(s)
+
+#endif
+
+// Minimum number of operations of each kind per depth.
+#define MIN_OPS 1000000
+
+// Maximum number of latency samples per operation and depth.
+#define LAT_SAMPLES 200000
+
+// The operations measured, in the order they run within a cycle.
+enum { OP_PUSH, OP_TOP, OP_POP, NUM_OPS };
+static const char *op_names[NUM_OPS] = { "push", "top", "pop" };
+
+// ==========MEASUREMENT HELPERS==========
+
+/**
+ * count_allocs() - Add the allocations since a snapshot to an operation.
+ * @since: Snapshot from alloc_track_get().
+ * @allocs: Number of allocations of the operation, incremented.
+ * @bytes: Bytes allocated by the operation, incremented.
+ *
+ * Returns: Nothing.
+ */
+static void count_allocs(const alloc_stats *since, long *allocs, long long *bytes)
+{
+    alloc_stats now = alloc_track_get();
+
+    *allocs += now.allocs - since->allocs;
+    *bytes += now.bytes - since->bytes;
+}
+
+/**
+ * read_status_kb() - Read a field from /proc/self/status.
+ * @field: Field name including the colon, e.g. "VmHWM:".
+ *
+ * Returns: The value in kB, or -1 if it is not available.
+ */
+static long read_status_kb(const char *field)
+{
+    FILE *f = fopen("/proc/self/status", "r");
+    char line[256];
+    long kb = -1;
+
+    if (f == NULL) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (strncmp(line, field, strlen(field)) == 0) {
+            kb = atol(line + strlen(field));
+        }
+    }
+    fclose(f);
+    return kb;
+}
+
+/**
+ * reset_peak_rss() - Reset the peak resident set size to the current one.
+ *
+ * Linux only; does nothing elsewhere.
+ *
+ * Returns: The current resident set size in kB, or -1 if unknown.
+ */
+static long reset_peak_rss(void)
+{
+    FILE *f = fopen("/proc/self/clear_refs", "w");
+
+    if (f != NULL) {
+        fputs("5", f);
+        fclose(f);
+    }
+    return read_status_kb("VmRSS:");
+}
+
+// Internal function to compare two latencies for qsort.
+static int compare_ll(const void *a, const void *b)
+{
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+// Internal function to return a percentile of a sorted array.
+static long long percentile(const long long *sorted, int n, double p)
+{
+    int i = (int)(p * (n - 1) + 0.5);
+    return sorted[i];
+}
+
+// ==========THE BENCHMARK==========
+
+// Sum of the inspected top values, printed to stderr so the
+// operations cannot be optimized away.
+static long check = 0;
+
+/**
+ * throughput_run() - Measure mean time, allocations and peak memory.
+ * @depth: Number of elements per cycle.
+ * @cycles: Number of push/top/pop cycles.
+ * @ns: Set to the total time per operation kind.
+ * @allocs: Set to the number of allocations per operation kind.
+ * @bytes: Set to the bytes allocated per operation kind.
+ * @peak_bytes: Set to the peak of live bytes allocated by the stack.
+ *
+ * Returns: The growth of the peak resident set size in kB, or -1.
+ */
+static long throughput_run(int depth, long cycles, long long ns[NUM_OPS],
+                           long allocs[NUM_OPS], long long bytes[NUM_OPS],
+                           long long *peak_bytes)
+{
+    long rss = reset_peak_rss();
+    alloc_stats start = alloc_track_get();
+    alloc_track_reset_peak();
+    suite_stack s = SUITE_EMPTY();
+
+    memset(ns, 0, NUM_OPS * sizeof(ns[0]));
+    memset(allocs, 0, NUM_OPS * sizeof(allocs[0]));
+    memset(bytes, 0, NUM_OPS * sizeof(bytes[0]));
+    for (long c = 0; c < cycles; c++) {
+        alloc_stats a = alloc_track_get();
+        long long t = now_ns();
+        for (int i = 0; i < depth; i++) {
+            SUITE_PUSH(s, i);
+        }
+        long long t1 = now_ns();
+        ns[OP_PUSH] += t1 - t;
+        count_allocs(&a, &allocs[OP_PUSH], &bytes[OP_PUSH]);
+
+        a = alloc_track_get();
+        for (int i = 0; i < depth; i++) {
+            check += SUITE_TOP(s);
+        }
+        long long t2 = now_ns();
+        ns[OP_TOP] += t2 - t1;
+        count_allocs(&a, &allocs[OP_TOP], &bytes[OP_TOP]);
+
+        a = alloc_track_get();
+        for (int i = 0; i < depth; i++) {
+            SUITE_POP(s);
+        }
+        ns[OP_POP] += now_ns() - t2;
+        count_allocs(&a, &allocs[OP_POP], &bytes[OP_POP]);
+    }
+    SUITE_KILL(s);
+    *peak_bytes = alloc_track_get().peak - start.live;
+
+    long peak = read_status_kb("VmHWM:");
+    return rss < 0 || peak < 0 ? -1 : peak - rss;
+}
+
+/**
+ * latency_run() - Time single operations.
+ * @depth: Number of elements per cycle.
+ * @lat: Arrays of LAT_SAMPLES latencies, one per operation kind.
+ *
+ * Times every stride:th operation so that at most LAT_SAMPLES
+ * operations of each kind are timed, cycling until that many samples
+ * are collected or MIN_OPS operations have run.
+ *
+ * Returns: The number of samples per operation kind.
+ */
+static int latency_run(int depth, long long *lat[NUM_OPS])
+{
+    long long overhead = clock_overhead();
+    int stride = depth > LAT_SAMPLES ? (depth + LAT_SAMPLES - 1) / LAT_SAMPLES : 1;
+    int samples = 0;
+    long ops = 0;
+    suite_stack s = SUITE_EMPTY();
+
+    while (samples < LAT_SAMPLES && ops < MIN_OPS) {
+        int start = samples;
+        for (int op = 0; op < NUM_OPS; op++) {
+            samples = start;
+            for (int i = 0; i < depth; i++) {
+                bool timed = i % stride == 0 && samples < LAT_SAMPLES;
+                long long t = timed ? now_ns() : 0;
+                switch (op) {
+                case OP_PUSH: SUITE_PUSH(s, i);        break;
+                case OP_TOP:  check += SUITE_TOP(s);   break;
+                case OP_POP:  SUITE_POP(s);            break;
+                }
+                if (timed) {
+                    long long d = now_ns() - t - overhead;
+                    lat[op][samples++] = d > 0 ? d : 0;
+                }
+            }
+        }
+        ops += depth;
+    }
+    SUITE_KILL(s);
+
+    for (int op = 0; op < NUM_OPS; op++) {
+        qsort(lat[op], samples, sizeof(long long), compare_ll);
+    }
+    return samples;
+}
+
+/**
+ * run_depth() - Run the suite for one depth and print the CSV lines.
+ * @depth: Number of elements per cycle.
+ *
+ * Returns: Nothing.
+ */
+static void run_depth(int depth)
+{
+    long cycles = MIN_OPS / depth > 0 ? MIN_OPS / depth : 1;
+    long long ns[NUM_OPS];
+    long allocs[NUM_OPS];
+    long long bytes[NUM_OPS];
+    long long peak_bytes;
+    long long *lat[NUM_OPS];
+
+    long rss = throughput_run(depth, cycles, ns, allocs, bytes, &peak_bytes);
+
+    for (int op = 0; op < NUM_OPS; op++) {
+        lat[op] = malloc(LAT_SAMPLES * sizeof(long long));
+    }
+    int n = latency_run(depth, lat);
+
+    for (int op = 0; op < NUM_OPS; op++) {
+        long ops = cycles * depth;
+        printf("%s,%d,%s,%ld,%.3f,%.6f,%.3f,%lld,%ld,%lld,%lld,%lld,%lld,%lld\n", BACKEND,
+               depth, op_names[op], ops, (double)ns[op] / ops, (double)allocs[op] / ops,
+               (double)bytes[op] / ops, peak_bytes, rss,
+               percentile(lat[op], n, 0.5), percentile(lat[op], n, 0.9),
+               percentile(lat[op], n, 0.99), percentile(lat[op], n, 0.999), lat[op][n - 1]);
+        free(lat[op]);
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    long max_depth = BACKEND_MAX_DEPTH;
+
+    if (argc > 1) {
+        max_depth = atol(argv[1]);
+        if (max_depth < 1) {
+            fprintf(stderr, "Usage: %s [max_depth]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+        if (max_depth > BACKEND_MAX_DEPTH) {
+            max_depth = BACKEND_MAX_DEPTH;
+        }
+    }
+
+    printf("backend,depth,op,ops,ns_per_op,allocs_per_op,bytes_per_op,peak_live_bytes,"
+           "peak_rss_kb,"
+           "p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+    for (long depth = 10; depth <= max_depth; depth *= 10) {
+        run_depth(depth);
+    }
+    fprintf(stderr, "check: %ld\n", check);
+
+    return 0;
+}
@@ -7,6 +7,8 @@
 #include <table.h>
 #include <dlist.h>
 
+#include "table_ext.h"
+
 /*
  * Implementation of a generic table for the "Datastructures and
  * algorithms" courses at the Department of Computing Science, Umea
@@ -24,6 +26,7 @@
  *   v1.1  2019-03-04: Bugfix in table_remove.
  *   v1.2  2024-04-15: Added table_print_internal.
  *   v2.0  2024-05-10: Updated print_internal with improved encapsulation.
+ *   v2.1  2026-10-18: Added table_update from table_ext.h.
  */
 
 // ===========INTERNAL DATA TYPES ============
@@ -164,6 +167,44 @@ void *table_lookup(const table *t, const void *key)
     return NULL;
 }
 
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * See table_ext.h.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx)
+{
+    // Iterate over the list. Update the first match.
+    dlist_pos pos = dlist_first(t->entries);
+
+    while (!dlist_is_end(t->entries, pos)) {
+        table_entry *e = dlist_inspect(t->entries, pos);
+        if (t->key_cmp_func(e->key, key) == 0) {
+            void *value = fn(e->value, true, ctx);
+            if (value != e->value && t->value_kill_func != NULL) {
+                t->value_kill_func(e->value);
+            }
+            e->value = value;
+            return value;
+        }
+        pos = dlist_next(t->entries, pos);
+    }
+
+    // No match found. Insert the new value, if any, at the front.
+    void *value = fn(NULL, false, ctx);
+    if (value != NULL) {
+        table_insert(t, key, value);
+    }
+    return value;
+}
+
 /**
  * table_choose_key() - Return an arbitrary key.
  * @t: Table to inspect.
@@ -0,0 +1,125 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+
+#include "table_backend.h"
+
+/*
+ * Run-time loading of table implementations, see table_backend.h.
+ *
+ * Each object is opened with RTLD_LOCAL so that its table functions
+ * do not become visible to the objects loaded after it.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: Added table_update.
+ *   v1.2  2026-10-18: Added table_lookup_or_insert.
+ *   v1.3  2026-10-18: Added table_range.
+ *   v1.4  2026-10-18: Added table_concurrent_lookup.
+ */
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * backend_name() - Derive the name of a backend from its path.
+ * @path: Path of the shared object.
+ *
+ * Returns: A new string with the file name without ".so".
+ */
+static char *backend_name(const char *path)
+{
+    const char *base = strrchr(path, '/');
+    base = base != NULL ? base + 1 : path;
+
+    size_t len = strlen(base);
+    if (len > 3 && strcmp(base + len - 3, ".so") == 0) {
+        len -= 3;
+    }
+    char *name = malloc(len + 1);
+    memcpy(name, base, len);
+    name[len] = '\0';
+
+    return name;
+}
+
+/**
+ * lookup_symbol() - Look up a function in a shared object.
+ * @handle: Handle from dlopen().
+ * @symbol: Name of the function.
+ * @required: If true, print an error message if the function is missing.
+ *
+ * Returns: The address of the function, or NULL if it is missing.
+ */
+static void *lookup_symbol(void *handle, const char *symbol, bool required)
+{
+    void *f = dlsym(handle, symbol);
+
+    if (f == NULL && required) {
+        fprintf(stderr, "table_backend_load: missing %s: %s\n", symbol, dlerror());
+    }
+    return f;
+}
+
+/**
+ * table_backend_load() - Load a table implementation from a shared object.
+ * @path: Path of the shared object.
+ *
+ * Returns: A pointer to the loaded backend, or NULL on failure.
+ */
+table_backend *table_backend_load(const char *path)
+{
+    // dlopen() searches the library path for names without '/'.
+    char *file = malloc(strlen(path) + 3);
+    sprintf(file, "%s%s", strchr(path, '/') != NULL ? "" : "./", path);
+    void *handle = dlopen(file, RTLD_NOW | RTLD_LOCAL);
+    free(file);
+
+    if (handle == NULL) {
+        fprintf(stderr, "table_backend_load: %s\n", dlerror());
+        return NULL;
+    }
+
+    table_backend *b = calloc(1, sizeof(*b));
+    b->handle = handle;
+
+    // Converting the void * from dlsym() to a function pointer is
+    // allowed by POSIX.
+    *(void **)&b->empty = lookup_symbol(handle, "table_empty", true);
+    *(void **)&b->is_empty = lookup_symbol(handle, "table_is_empty", true);
+    *(void **)&b->insert = lookup_symbol(handle, "table_insert", true);
+    *(void **)&b->lookup = lookup_symbol(handle, "table_lookup", true);
+    *(void **)&b->choose_key = lookup_symbol(handle, "table_choose_key", true);
+    *(void **)&b->remove = lookup_symbol(handle, "table_remove", true);
+    *(void **)&b->kill = lookup_symbol(handle, "table_kill", true);
+    *(void **)&b->empty_hashed = lookup_symbol(handle, "table_empty_hashed", false);
+    *(void **)&b->update = lookup_symbol(handle, "table_update", false);
+    *(void **)&b->lookup_or_insert = lookup_symbol(handle, "table_lookup_or_insert", false);
+    *(void **)&b->range = lookup_symbol(handle, "table_range", false);
+    *(void **)&b->concurrent_lookup = lookup_symbol(handle, "table_concurrent_lookup", false);
+
+    if (b->empty == NULL || b->is_empty == NULL || b->insert == NULL || b->lookup == NULL ||
+        b->choose_key == NULL || b->remove == NULL || b->kill == NULL) {
+        dlclose(handle);
+        free(b);
+        return NULL;
+    }
+    b->name = backend_name(path);
+
+    return b;
+}
+
+/**
+ * table_backend_unload() - Unload a table implementation.
+ * @b: Backend to unload.
+ *
+ * Returns: Nothing.
+ */
+void table_backend_unload(table_backend *b)
+{
+    dlclose(b->handle);
+    free(b->name);
+    free(b);
+}
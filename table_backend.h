@@ -0,0 +1,92 @@
+#ifndef TABLE_BACKEND_H
+#define TABLE_BACKEND_H
+
+#include <table.h>
+
+#include "table_ext.h"
+
+/*
+ * Run-time loading of table implementations.
+ *
+ * All table implementations in this directory define the same
+ * table.h functions, so a program can only link with one of them. To
+ * compare several in one program, each implementation is built as a
+ * shared object, e.g.
+ *
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o table.so \
+ *       table.c table_lookup_or_insert.c dlist.c
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o mtftable.so \
+ *       mtftable.c table_lookup_or_insert.c dlist.c
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o arraytable.so \
+ *       arraytable.c table_lookup_or_insert.c array_1d.c
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o hashtable.so \
+ *       hashtable.c table_ext.c table_lookup_or_insert.c dlist.c array_1d.c
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o sortedtable.so \
+ *       sortedtable.c table_lookup_or_insert.c
+ *   gcc -std=c11 -shared -fPIC -Wl,-Bsymbolic -I<include> -o skiptable.so \
+ *       skiptable.c table_lookup_or_insert.c
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o hybridtable.so \
+ *       hybridtable.c table_lookup_or_insert.c
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o autotable.so \
+ *       autotable.c table_lookup_or_insert.c
+ *   gcc -shared -fPIC -Wl,-Bsymbolic -I<include> -o lrutable.so \
+ *       lrutable.c table_lookup_or_insert.c
+ *
+ * and loaded with table_backend_load(). -Bsymbolic makes the table
+ * functions inside an object call their own helpers even when several
+ * objects define the same names. Programs using the loader are linked
+ * with -ldl on older C libraries.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ *   v1.1  2026-10-18: Added table_update.
+ *   v1.2  2026-10-18: Added table_lookup_or_insert.
+ *   v1.3  2026-10-18: Added table_range.
+ *   v1.4  2026-10-18: Added table_concurrent_lookup.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// A loaded table implementation. The function pointers have the
+// signatures of the corresponding table.h functions.
+typedef struct table_backend {
+    char *name; // File name of the object without directory and ".so"
+    void *handle; // Handle from dlopen()
+    table *(*empty)(compare_function *, kill_function, kill_function);
+    bool (*is_empty)(const table *);
+    void (*insert)(table *, void *, void *);
+    void *(*lookup)(const table *, const void *);
+    void *(*choose_key)(const table *);
+    void (*remove)(table *, const void *);
+    void (*kill)(table *);
+    // Optional extensions from table_ext.h, or NULL if not provided.
+    table *(*empty_hashed)(compare_function *, hash_function *, kill_function,
+                           kill_function);
+    void *(*update)(table *, void *, update_function *, void *);
+    void *(*lookup_or_insert)(table *, void *, make_value_function *);
+    int (*range)(const table *, const void *, const void *, range_callback *, void *);
+    bool (*concurrent_lookup)(void);
+} table_backend;
+
+// ==========INTERFACE==========
+
+/**
+ * table_backend_load() - Load a table implementation from a shared object.
+ * @path: Path of the shared object. A path without '/' is taken
+ *        relative to the current directory.
+ *
+ * Returns: A pointer to the loaded backend, or NULL with an error
+ *          message on stderr if the object cannot be loaded or lacks
+ *          a table.h function.
+ */
+table_backend *table_backend_load(const char *path);
+
+/**
+ * table_backend_unload() - Unload a table implementation.
+ * @b: Backend to unload. All its tables must have been killed.
+ *
+ * Returns: Nothing.
+ */
+void table_backend_unload(table_backend *b);
+
+#endif
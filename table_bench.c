@@ -0,0 +1,211 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <table.h>
+
+#include "bench_clock.h"
+#include "histogram.h"
+#include "int_fixture.h"
+#include "perf_counters.h"
+
+#ifdef TABLE_HASHED
+#include "table_ext.h"
+#endif
+
+/**
+ * table_bench.c - Benchmarks for the table implementations.
+ *
+ * The program is linked with one of the table implementations in this
+ * directory (table.c, mtftable.c, arraytable.c), e.g.
+ *
+ *   gcc -O2 -I<include> table_bench.c histogram.c perf_counters.c bench_clock.c \
+ *       int_fixture.c arraytable.c array_1d.c
+ *
+ * Define TABLE_HASHED when linking with hashtable.c to create the
+ * table with table_empty_hashed() and hash_int() from table_ext.c.
+ *
+ * Usage: table_bench [n]
+ *
+ * Builds a table of n distinct integer keys (default 10^6), looks up
+ * and removes every key, and measures the latency of every operation
+ * with histogram.h. It prints p50, p90, p99, p99.9 and the maximum of
+ * each operation; the tail shows the long scans of the list tables and
+ * whether any single insert pays for a resize of the whole table.
+ * Note that the list and array implementations scan all entries on
+ * each insert or lookup, so a smaller n is needed for them to finish
+ * in reasonable time.
+ *
+ * It then builds a new table of the same keys and looks up every key,
+ * timing each phase as a whole, and prints the time and the hardware
+ * counters of perf_counters.h per operation: cycles, instructions,
+ * cache, TLB and branch misses. Where the counters are unavailable,
+ * e.g. in most containers, "counters=n/a" is printed instead.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version with the insert latency benchmark.
+ * 2026-10-18 v1.1: Added TABLE_HASHED for hashed tables.
+ * 2026-10-18 v1.2: Added the insert and lookup throughput with hardware counters.
+ * 2026-10-18 v1.3: Latency percentiles of insert, lookup and remove.
+ * 2026-10-18 v1.4: Clock helpers moved to bench_clock.c.
+ * 2026-10-18 v1.5: Use compare_int from int_fixture.c.
+ */
+
+#ifndef TABLE_BACKEND
+#define TABLE_BACKEND "table"
+#endif
+
+#define DEFAULT_N 1000000
+
+// Internal function to print the latency distribution of one operation.
+static void report_latency(const char *op, int n, const histogram *h)
+{
+    char buf[256];
+
+    printf("%s: %s n=%d mean=%.1f ns %s ns\n", TABLE_BACKEND, op, n, histogram_mean(h),
+           histogram_format(h, buf, sizeof(buf)));
+}
+
+/**
+ * latency_bench() - Measure per-operation latency of a table.
+ * @n: Number of keys.
+ *
+ * Inserts n distinct keys into an empty table, looks up each key and
+ * removes each key, timing every operation. Prints the latency
+ * percentiles of each operation, minus the overhead of reading the
+ * clock, and the position of the slowest insert.
+ *
+ * Returns: Nothing.
+ */
+static void latency_bench(int n)
+{
+    // Allocate all keys up front to keep malloc out of the measurement.
+    int *keys = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        keys[i] = i;
+    }
+
+    // The keys are owned by the benchmark, not the table.
+#ifdef TABLE_HASHED
+    table *t = table_empty_hashed(compare_int, hash_int, NULL, NULL);
+#else
+    table *t = table_empty(compare_int, NULL, NULL);
+#endif
+
+    histogram *h = histogram_empty();
+    long long overhead = clock_overhead();
+    long long max = 0;
+    int max_pos = 0;
+    long found = 0;
+
+    for (int i = 0; i < n; i++) {
+        long long start = now_ns();
+        table_insert(t, &keys[i], &keys[i]);
+        long long ns = now_ns() - start - overhead;
+
+        histogram_record(h, ns);
+        if (ns > max) {
+            max = ns;
+            max_pos = i;
+        }
+    }
+    report_latency("insert", n, h);
+    printf("%s: slowest insert is #%d\n", TABLE_BACKEND, max_pos);
+
+    histogram_reset(h);
+    for (int i = 0; i < n; i++) {
+        long long start = now_ns();
+        found += table_lookup(t, &keys[i]) != NULL;
+        histogram_record(h, now_ns() - start - overhead);
+    }
+    report_latency("lookup", n, h);
+
+    histogram_reset(h);
+    for (int i = 0; i < n; i++) {
+        long long start = now_ns();
+        table_remove(t, &keys[i]);
+        histogram_record(h, now_ns() - start - overhead);
+    }
+    report_latency("remove", n, h);
+
+    if (found != n) {
+        fprintf(stderr, "FAIL: %ld of %d lookups found their key\n", found, n);
+        exit(EXIT_FAILURE);
+    }
+    histogram_kill(h);
+    table_kill(t);
+    free(keys);
+}
+
+/**
+ * throughput_bench() - Measure insert and lookup throughput with counters.
+ * @n: Number of keys.
+ *
+ * Inserts n distinct keys into an empty table, then looks up each key
+ * once, in the same order.
+ *
+ * Returns: Nothing.
+ */
+static void throughput_bench(int n)
+{
+    int *keys = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        keys[i] = i;
+    }
+#ifdef TABLE_HASHED
+    table *t = table_empty_hashed(compare_int, hash_int, NULL, NULL);
+#else
+    table *t = table_empty(compare_int, NULL, NULL);
+#endif
+    perf_counters *pc = perf_counters_open();
+    long long values[PERF_NUM_COUNTERS];
+    char buf[256];
+    long found = 0;
+
+    perf_counters_start(pc);
+    long long start = now_ns();
+    for (int i = 0; i < n; i++) {
+        table_insert(t, &keys[i], &keys[i]);
+    }
+    long long ns = now_ns() - start;
+    perf_counters_stop(pc, values);
+    printf("%s: insert n=%d %.1f ns/op %s\n", TABLE_BACKEND, n, (double)ns / n,
+           perf_counters_format(values, n, buf, sizeof(buf)));
+
+    perf_counters_start(pc);
+    start = now_ns();
+    for (int i = 0; i < n; i++) {
+        found += table_lookup(t, &keys[i]) != NULL;
+    }
+    ns = now_ns() - start;
+    perf_counters_stop(pc, values);
+    printf("%s: lookup n=%d %.1f ns/op %s\n", TABLE_BACKEND, n, (double)ns / n,
+           perf_counters_format(values, n, buf, sizeof(buf)));
+
+    if (found != n) {
+        fprintf(stderr, "FAIL: %ld of %d lookups found their key\n", found, n);
+        exit(EXIT_FAILURE);
+    }
+    perf_counters_close(pc);
+    table_kill(t);
+    free(keys);
+}
+
+int main(int argc, char *argv[])
+{
+    int n = DEFAULT_N;
+
+    if (argc > 1) {
+        n = atoi(argv[1]);
+        if (n <= 0) {
+            fprintf(stderr, "Usage: %s [n]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    latency_bench(n);
+    throughput_bench(n);
+
+    return 0;
+}
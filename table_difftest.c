@@ -0,0 +1,494 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#include "bench_clock.h"
+#include "int_fixture.h"
+#include "table_backend.h"
+
+/**
+ * table_difftest.c - Randomized differential tester for the table backends.
+ *
+ * Compile with the loader and build each backend as a shared object
+ * as described in table_backend.h:
+ *
+ *   gcc -O2 -I<include> table_difftest.c table_backend.c table_ext.c int_fixture.c \
+ *       bench_clock.c -ldl
+ *
+ * Usage: table_difftest [-s seed] [-n sequences] [-o ops] [-k keys] backend.so...
+ *
+ * Generates n (default 10) random sequences of ops (default 10000)
+ * insert, lookup, remove, is_empty and choose_key operations on keys
+ * 0..keys-1 (default 1000), from the seeds seed, seed+1, ... (default
+ * 1). Each sequence ends by removing all keys returned by choose_key
+ * and killing the table. Every sequence is run against every backend
+ * together with a reference model, and any divergence from the model
+ * is reported:
+ *  - lookup returns another value than the last one inserted, or a
+ *    value for a removed key,
+ *  - is_empty or choose_key disagree with the set of present keys,
+ *  - a key or value is killed twice, killed while still in the table,
+ *    not killed by the remove of its key or by the kill of the table,
+ *    or a key that the table does not own is killed.
+ * When a key is inserted twice, the model accepts that the old key
+ * and value are killed either at the insert (replacing backends) or
+ * at the remove (backends that keep duplicates).
+ *
+ * Each sequence is then run once more without the model, and the
+ * time per backend is printed. Every backend is run as a variant
+ * created with table_empty(). Backends that provide
+ * table_empty_hashed() are also run as a second variant, named with
+ * "/hashed", created with it, since some backends store the table
+ * differently when they can hash.
+ *
+ * The exit status is nonzero if any divergence was found.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Hashed and unhashed variants of each backend.
+ * 2026-10-18 v1.2: Use next_random from int_fixture.c.
+ * 2026-10-18 v1.3: Time the sequences with now_ns() from bench_clock.c.
+ */
+
+// Maximum number of divergences printed per backend and sequence.
+#define MAX_REPORTS 5
+
+// Kinds of operations in a sequence.
+typedef enum op_kind {
+    OP_INSERT,
+    OP_LOOKUP,
+    OP_REMOVE,
+    OP_IS_EMPTY,
+    OP_CHOOSE_KEY,
+} op_kind;
+
+static const char *op_names[] = { "insert", "lookup", "remove", "is_empty", "choose_key" };
+
+// A backend and the way its tables are created.
+typedef struct variant {
+    const table_backend *b;
+    bool hashed; // Create the tables with table_empty_hashed()
+    char name[64];
+} variant;
+
+// One operation of a sequence.
+typedef struct op {
+    op_kind kind;
+    int key;
+} op;
+
+// An object passed to a table as key or value. The objects of a run
+// live in a pool that is freed after the run, so a backend that kills
+// an object too early is detected instead of crashing the tester.
+typedef struct object {
+    int key; // The key this object was created for
+    int id; // Index in the pool
+    int kills; // Number of times the table killed this object
+    bool owned; // True if the table owns the object
+    int next; // Next object inserted for the same key, or -1
+} object;
+
+// State of one run of a sequence against a backend.
+typedef struct run {
+    const variant *v;
+    const table_backend *b;
+    table *t;
+    object *pool;
+    int n_objects;
+    int *current; // current[k] is the value object of key k, or -1
+    int *pending; // pending[k] is the first object inserted for k since its last remove
+    int n_present; // Number of keys present according to the model
+    bool check; // If false, the model is not updated or checked
+    unsigned seed;
+    int op_index; // Index of the current operation, or -1 after the sequence
+    int divergences;
+} run;
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * generate() - Generate a random sequence of operations.
+ * @seed: Seed of the sequence.
+ * @n: Number of operations.
+ * @keys: Number of distinct keys.
+ *
+ * Returns: An array of n operations.
+ */
+static op *generate(unsigned seed, int n, int keys)
+{
+    op *ops = malloc(n * sizeof(*ops));
+    unsigned state = seed * 2654435761u + 1;
+
+    for (int i = 0; i < n; i++) {
+        unsigned r = next_random(&state) % 100;
+        // 40% insert, 30% lookup, 20% remove, 5% is_empty, 5% choose_key.
+        ops[i].kind = r < 40 ? OP_INSERT : r < 70 ? OP_LOOKUP : r < 90 ? OP_REMOVE :
+                      r < 95 ? OP_IS_EMPTY : OP_CHOOSE_KEY;
+        ops[i].key = next_random(&state) % keys;
+    }
+    return ops;
+}
+
+// Internal functions passed to the tables.
+static int compare_objects(const void *a, const void *b)
+{
+    int x = ((const object *)a)->key;
+    int y = ((const object *)b)->key;
+    return (x > y) - (x < y);
+}
+
+static unsigned long hash_object(const void *o)
+{
+    return hash_int(&((const object *)o)->key);
+}
+
+// Number of times a table passed NULL to kill_object().
+static int null_kills = 0;
+
+static void kill_object(void *o)
+{
+    if (o == NULL) {
+        null_kills++;
+        return;
+    }
+    ((object *)o)->kills++;
+}
+
+/**
+ * report() - Report a divergence from the model.
+ * @r: Run that diverged.
+ * @fmt: printf format of the message, followed by its arguments.
+ *
+ * Only the checked run reports.
+ *
+ * Returns: Nothing.
+ */
+static void report(run *r, const char *fmt, ...)
+{
+    // The timed run repeats the checked run, so it does not report.
+    if (!r->check) {
+        return;
+    }
+    if (r->divergences++ >= MAX_REPORTS) {
+        return;
+    }
+    if (r->op_index >= 0) {
+        printf("  DIVERGENCE %s seed=%u op=%d: ", r->v->name, r->seed, r->op_index);
+    } else {
+        printf("  DIVERGENCE %s seed=%u end: ", r->v->name, r->seed);
+    }
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    printf("\n");
+}
+
+/**
+ * new_object() - Take a new object from the pool of a run.
+ * @r: Run.
+ * @key: Key of the object.
+ * @owned: True if the object will be owned by the table.
+ *
+ * Returns: A pointer to the object.
+ */
+static object *new_object(run *r, int key, bool owned)
+{
+    object *o = &r->pool[r->n_objects];
+    *o = (object) { key, r->n_objects, 0, owned, -1 };
+    r->n_objects++;
+
+    if (owned && r->check) {
+        o->next = r->pending[key];
+        r->pending[key] = o->id;
+    }
+    return o;
+}
+
+// Internal function to describe a value object for a report.
+static const char *describe(const run *r, int id, char *buf)
+{
+    if (id < 0) {
+        return "NULL";
+    }
+    sprintf(buf, "value #%d of key %d", id, r->pool[id].key);
+    return buf;
+}
+
+/**
+ * check_removed() - Check that all objects of a removed key were killed once.
+ * @r: Run.
+ * @key: Removed key.
+ *
+ * Returns: Nothing.
+ */
+static void check_removed(run *r, int key)
+{
+    for (int id = r->pending[key]; id >= 0; id = r->pool[id].next) {
+        if (r->pool[id].kills != 1) {
+            report(r, "remove(%d) left object #%d killed %d times", key, id,
+                   r->pool[id].kills);
+        }
+    }
+    r->pending[key] = -1;
+    if (r->current[key] >= 0) {
+        r->current[key] = -1;
+        r->n_present--;
+    }
+}
+
+/**
+ * apply() - Apply one operation to the table and the model.
+ * @r: Run.
+ * @o: Operation.
+ *
+ * Returns: Nothing.
+ */
+static void apply(run *r, const op *o)
+{
+    const table_backend *b = r->b;
+    char buf1[64];
+    char buf2[64];
+    object *tmp = NULL;
+
+    switch (o->kind) {
+    case OP_INSERT: {
+        object *key = new_object(r, o->key, true);
+        object *value = new_object(r, o->key, true);
+        b->insert(r->t, key, value);
+        if (r->check) {
+            if (r->current[o->key] < 0) {
+                r->n_present++;
+            }
+            r->current[o->key] = value->id;
+        }
+        break;
+    }
+    case OP_LOOKUP: {
+        tmp = new_object(r, o->key, false);
+        object *v = b->lookup(r->t, tmp);
+        if (r->check) {
+            int got = v != NULL ? v->id : -1;
+            if (got != r->current[o->key]) {
+                report(r, "lookup(%d) returned %s, model has %s", o->key,
+                       describe(r, got, buf1), describe(r, r->current[o->key], buf2));
+            } else if (v != NULL && v->kills > 0) {
+                report(r, "lookup(%d) returned a killed value", o->key);
+            }
+        }
+        break;
+    }
+    case OP_REMOVE:
+        tmp = new_object(r, o->key, false);
+        b->remove(r->t, tmp);
+        if (r->check) {
+            check_removed(r, o->key);
+        }
+        break;
+    case OP_IS_EMPTY: {
+        bool empty = b->is_empty(r->t);
+        if (r->check && empty != (r->n_present == 0)) {
+            report(r, "is_empty returned %s with %d keys present", empty ? "true" : "false",
+                   r->n_present);
+        }
+        break;
+    }
+    case OP_CHOOSE_KEY:
+        // Undefined for an empty table. Without the model, ask the table.
+        if (r->check ? r->n_present == 0 : b->is_empty(r->t)) {
+            break;
+        }
+        object *k = b->choose_key(r->t);
+        if (r->check && (k == NULL || !k->owned || k->kills > 0 || r->current[k->key] < 0)) {
+            report(r, "choose_key returned a key that is not present");
+        }
+        break;
+    }
+
+    if (tmp != NULL && tmp->kills > 0) {
+        report(r, "%s(%d) killed a key owned by the caller", op_names[o->kind], o->key);
+    }
+    if (null_kills > 0) {
+        report(r, "%s(%d) called the kill function with NULL", op_names[o->kind], o->key);
+        null_kills = 0;
+    }
+}
+
+/**
+ * drain() - Remove all keys returned by choose_key, then kill the table.
+ * @r: Run.
+ *
+ * Returns: Nothing.
+ */
+static void drain(run *r)
+{
+    const table_backend *b = r->b;
+
+    r->op_index = -1;
+    // Bound the loop in case is_empty never becomes true.
+    for (int guard = r->n_present; !b->is_empty(r->t) && guard >= 0; guard--) {
+        object *k = b->choose_key(r->t);
+        if (k == NULL || (r->check && (k->kills > 0 || r->current[k->key] < 0))) {
+            report(r, "choose_key returned a key that is not present");
+            break;
+        }
+        int key = k->key;
+        // Pass the key owned by the table, as a caller emptying a table would.
+        b->remove(r->t, k);
+        if (r->check) {
+            check_removed(r, key);
+        }
+    }
+    if (r->check && (!b->is_empty(r->t) || r->n_present != 0)) {
+        report(r, "table not empty after removing all keys, model has %d keys", r->n_present);
+    }
+    b->kill(r->t);
+    if (null_kills > 0) {
+        report(r, "the kill function was called with NULL %d times", null_kills);
+        null_kills = 0;
+    }
+
+    if (r->check) {
+        for (int i = 0; i < r->n_objects; i++) {
+            object *o = &r->pool[i];
+            if (o->kills != (o->owned ? 1 : 0)) {
+                report(r, "object #%d (key %d, %s) killed %d times", i, o->key,
+                       o->owned ? "owned" : "not owned", o->kills);
+            }
+        }
+    }
+}
+
+/**
+ * run_sequence() - Run a sequence against one variant of a backend.
+ * @v: Variant.
+ * @ops: Operations.
+ * @n: Number of operations.
+ * @keys: Number of distinct keys.
+ * @seed: Seed of the sequence, for the reports.
+ * @check: If true, check the results against the model.
+ * @divergences: Incremented by the number of divergences.
+ *
+ * Returns: The elapsed time in nanoseconds.
+ */
+static long long run_sequence(const variant *v, const op *ops, int n, int keys,
+                              unsigned seed, bool check, int *divergences)
+{
+    const table_backend *b = v->b;
+    run r = { .v = v, .b = b, .check = check, .seed = seed };
+
+    // Each operation uses at most two objects.
+    r.pool = malloc((2 * n + 1) * sizeof(object));
+    r.current = malloc(keys * sizeof(int));
+    r.pending = malloc(keys * sizeof(int));
+    for (int k = 0; k < keys; k++) {
+        r.current[k] = -1;
+        r.pending[k] = -1;
+    }
+
+    long long start = now_ns();
+    if (v->hashed) {
+        r.t = b->empty_hashed(compare_objects, hash_object, kill_object, kill_object);
+    } else {
+        r.t = b->empty(compare_objects, kill_object, kill_object);
+    }
+    for (int i = 0; i < n; i++) {
+        r.op_index = i;
+        apply(&r, &ops[i]);
+    }
+    drain(&r);
+    long long elapsed = now_ns() - start;
+
+    if (r.divergences > MAX_REPORTS) {
+        printf("  ... %d more divergences for %s\n", r.divergences - MAX_REPORTS, v->name);
+    }
+    *divergences += r.divergences;
+    free(r.pool);
+    free(r.current);
+    free(r.pending);
+
+    return elapsed;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned seed = 1;
+    int sequences = 10;
+    int n = 10000;
+    int keys = 1000;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:n:o:k:")) != -1) {
+        switch (opt) {
+        case 's': seed = strtoul(optarg, NULL, 10); break;
+        case 'n': sequences = atoi(optarg);         break;
+        case 'o': n = atoi(optarg);                 break;
+        case 'k': keys = atoi(optarg);              break;
+        default:  optind = argc + 1;                break;
+        }
+    }
+    int n_backends = argc - optind;
+    if (optind > argc || n_backends < 1 || sequences < 1 || n < 1 || keys < 1) {
+        fprintf(stderr, "Usage: %s [-s seed] [-n sequences] [-o ops] [-k keys] backend.so...\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    table_backend **backends = malloc(n_backends * sizeof(*backends));
+    variant *variants = malloc(2 * n_backends * sizeof(*variants));
+    int n_variants = 0;
+    for (int i = 0; i < n_backends; i++) {
+        backends[i] = table_backend_load(argv[optind + i]);
+        if (backends[i] == NULL) {
+            return EXIT_FAILURE;
+        }
+        variant *v = &variants[n_variants++];
+        *v = (variant) { .b = backends[i], .hashed = false };
+        snprintf(v->name, sizeof(v->name), "%s", backends[i]->name);
+        if (backends[i]->empty_hashed != NULL) {
+            v = &variants[n_variants++];
+            *v = (variant) { .b = backends[i], .hashed = true };
+            snprintf(v->name, sizeof(v->name), "%s/hashed", backends[i]->name);
+        }
+    }
+    int *divergences = calloc(n_variants, sizeof(int));
+    long long *total_ns = calloc(n_variants, sizeof(long long));
+
+    for (int s = 0; s < sequences; s++) {
+        op *ops = generate(seed + s, n, keys);
+        printf("sequence seed=%u ops=%d keys=%d\n", seed + s, n, keys);
+        for (int i = 0; i < n_variants; i++) {
+            int before = divergences[i];
+            run_sequence(&variants[i], ops, n, keys, seed + s, true, &divergences[i]);
+            long long ns = run_sequence(&variants[i], ops, n, keys, seed + s, false,
+                                        &divergences[i]);
+            total_ns[i] += ns;
+            printf("  %-18s %9.3f ms %s\n", variants[i].name, ns / 1e6,
+                   divergences[i] > before ? "DIVERGED" : "ok");
+        }
+        free(ops);
+    }
+
+    int status = EXIT_SUCCESS;
+    printf("summary\n");
+    for (int i = 0; i < n_variants; i++) {
+        printf("  %-18s %9.3f ms total, %d divergences\n", variants[i].name,
+               total_ns[i] / 1e6, divergences[i]);
+        if (divergences[i] > 0) {
+            status = EXIT_FAILURE;
+        }
+    }
+    for (int i = 0; i < n_backends; i++) {
+        table_backend_unload(backends[i]);
+    }
+    free(backends);
+    free(variants);
+    free(divergences);
+    free(total_ns);
+
+    return status;
+}
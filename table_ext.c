@@ -0,0 +1,56 @@
+#include <stdlib.h>
+
+#include "table_ext.h"
+
+/*
+ * Helper functions for the table extensions in table_ext.h that are
+ * shared by all table implementations.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version with hash functions for int and
+ *                     string keys.
+ */
+
+/**
+ * hash_int() - Hash an int key.
+ * @key: Pointer to the int to hash.
+ *
+ * Consecutive ints are spread over all bits of the hash value (using
+ * the finalizer of MurmurHash3), so that the lowest bits can be used
+ * directly as a bucket index.
+ *
+ * Returns: The hash value of the key.
+ */
+unsigned long hash_int(const void *key)
+{
+    unsigned long long h = (unsigned int)*(const int *)key;
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return (unsigned long)h;
+}
+
+/**
+ * hash_string() - Hash a 0-terminated string key.
+ * @key: Pointer to the string to hash.
+ *
+ * Uses the 64-bit FNV-1a hash.
+ *
+ * Returns: The hash value of the key.
+ */
+unsigned long hash_string(const void *key)
+{
+    const unsigned char *s = key;
+    unsigned long long h = 0xcbf29ce484222325ULL;
+
+    while (*s != '\0') {
+        h ^= *s++;
+        h *= 0x100000001b3ULL;
+    }
+
+    return (unsigned long)h;
+}
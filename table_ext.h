@@ -0,0 +1,295 @@
+#ifndef TABLE_EXT_H
+#define TABLE_EXT_H
+
+#include <stddef.h>
+
+#include <table.h>
+
+/*
+ * Extensions to the generic table interface in table.h.
+ *
+ * The table implementations in this directory all implement table.h.
+ * The functions declared here are only provided by some of them; the
+ * comment of each function lists which.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version with hashed table creation.
+ *   v1.1  2026-10-18: Added table_update.
+ *   v1.2  2026-10-18: Added table_lookup_or_insert.
+ *   v1.3  2026-10-18: Added table_range.
+ *   v1.4  2026-10-18: Added table_concurrent_lookup.
+ *   v1.5  2026-10-18: Added table_get_stats.
+ *   v1.6  2026-10-18: Added table_set_capacity and table_set_evict.
+ *   v1.7  2026-10-18: update_function is told if the key is present.
+ *   v1.8  2026-10-18: Noted the tables where lookups modify the table.
+ */
+
+/**
+ * hash_function - Function type for computing the hash of a key.
+ *
+ * Keys that compare equal with the key compare function of the table
+ * must have the same hash value.
+ */
+typedef unsigned long hash_function(const void *key);
+
+/**
+ * table_empty_hashed() - Create an empty table that hashes its keys.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function to be used to hash keys.
+ * @key_kill_func: A pointer to a function (or NULL) to be called to
+ *                 de-allocate memory for keys on remove/kill.
+ * @value_kill_func: A pointer to a function (or NULL) to be called to
+ *                   de-allocate memory for values on remove/kill.
+ *
+ * Provided by: hashtable.c, hybridtable.c, autotable.c, lrutable.c.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_hashed(compare_function *key_cmp_func,
+                          hash_function *key_hash_func,
+                          kill_function key_kill_func,
+                          kill_function value_kill_func);
+
+/**
+ * update_function - Function type for computing the new value of a key.
+ * @value: The current value of the key, or NULL if the key is absent.
+ * @present: True if the key is in the table. A present key may have
+ *           the value NULL.
+ * @ctx: The context pointer given to table_update().
+ *
+ * The function may modify the value in place and return it, or return
+ * a new value. For an absent key, returning NULL leaves the table
+ * unchanged.
+ *
+ * Returns: The value to store for the key.
+ */
+typedef void *update_function(void *value, bool present, void *ctx);
+
+/**
+ * table_update() - Update the value of a key with a single search.
+ * @t: Table to manipulate.
+ * @key: Key to update.
+ * @fn: Function that computes the new value.
+ * @ctx: Context pointer passed on to fn.
+ *
+ * Looks up the key once and calls fn with its value. If the key is
+ * present, the value returned by fn replaces the current one; if it
+ * is a different pointer, the old value is de-allocated with the value
+ * kill function, so fn must not free it. The table keeps its own key,
+ * and the caller remains the owner of key. If the table contains
+ * duplicates of the key, the latest inserted one is updated.
+ *
+ * If the key is absent and fn returns a value, the key/value pair is
+ * inserted as by table_insert() and the table takes over key.
+ *
+ * This replaces the sequence table_lookup() followed by
+ * table_insert(), which searches the list and array tables twice.
+ *
+ * Provided by: table.c, mtftable.c, arraytable.c, hashtable.c,
+ * sortedtable.c, skiptable.c, hybridtable.c, autotable.c, lrutable.c.
+ *
+ * Returns: The value stored for the key after the update, or NULL if
+ * the key is absent and fn returned NULL.
+ */
+void *table_update(table *t, void *key, update_function *fn, void *ctx);
+
+/**
+ * make_value_function - Function type for creating the value of a new key.
+ * @key: The key that is about to be inserted.
+ *
+ * Returns: The value to insert. Must not be NULL.
+ */
+typedef void *make_value_function(const void *key);
+
+/**
+ * table_lookup_or_insert() - Return the value of a key, inserting it if absent.
+ * @t: Table to manipulate.
+ * @key: Key to look up.
+ * @make_value: Function that creates the value of an absent key.
+ *
+ * Looks up the key once with table_update(). If the key is present,
+ * its value is returned and the caller remains the owner of key. If
+ * the key is absent, make_value is called, the key/value pair is
+ * inserted and the table takes over key; the caller can tell the two
+ * cases apart by whether make_value was called.
+ *
+ * Defined in table_lookup_or_insert.c for all tables that provide
+ * table_update().
+ *
+ * Returns: The existing or newly inserted value.
+ */
+void *table_lookup_or_insert(table *t, void *key, make_value_function *make_value);
+
+/**
+ * range_callback - Function type for visiting the entries of a range.
+ * @key: The key of the entry.
+ * @value: The value of the entry.
+ * @ctx: The context pointer given to table_range().
+ *
+ * Returns: Nothing.
+ */
+typedef void range_callback(const void *key, void *value, void *ctx);
+
+/**
+ * table_range() - Visit the entries between two keys in order.
+ * @t: Table to inspect.
+ * @lo: Lowest key to visit, or NULL to start at the smallest key.
+ * @hi: Highest key to visit, or NULL to end at the largest key.
+ * @callback: Function called for each entry.
+ * @ctx: Context pointer passed on to callback.
+ *
+ * Calls callback for every entry whose key k satisfies lo <= k <= hi
+ * according to the key compare function, in ascending key order. The
+ * callback must not modify the table.
+ *
+ * Provided by: sortedtable.c, skiptable.c.
+ *
+ * Returns: The number of visited entries.
+ */
+int table_range(const table *t, const void *lo, const void *hi,
+                range_callback *callback, void *ctx);
+
+/**
+ * table_concurrent_lookup() - Check if lookups may run concurrently with a writer.
+ *
+ * Tables that provide this function allow one thread to insert,
+ * update and remove while other threads call table_lookup(),
+ * table_range(), table_is_empty(), table_choose_key() and
+ * table_print() without a lock. The comment of the implementation
+ * gives the details. All other tables need a lock around every
+ * operation when they are shared. Note that in some tables
+ * table_lookup() and table_choose_key() modify the table despite the
+ * const table pointer, so two lookups must not run at the same time
+ * either. table_lookup() reorders the entries in mtftable.c,
+ * autotable.c and lrutable.c and advances a resize in arraytable.c
+ * and hashtable.c, and table_choose_key() moves a search hint in
+ * hashtable.c, hybridtable.c and autotable.c.
+ *
+ * Provided by: skiptable.c.
+ *
+ * Returns: True.
+ */
+bool table_concurrent_lookup(void);
+
+/**
+ * table_layout - The layouts that a self-tuning table can use.
+ */
+typedef enum table_layout {
+    TABLE_LAYOUT_LIST,  // Linked list in move-to-front order, as mtftable.c
+    TABLE_LAYOUT_ARRAY, // Array searched linearly, as arraytable.c
+    TABLE_LAYOUT_HASH,  // Open addressing hash table
+} table_layout;
+
+// Number of table layouts.
+#define TABLE_LAYOUTS 3
+
+/**
+ * table_stats - Statistics of a self-tuning table.
+ *
+ * The window fields describe the latest completed window of searches,
+ * on which the latest layout decision was based. The costs are in
+ * units of one key compare in an array; a layout is only chosen if
+ * the table is able to use it.
+ */
+typedef struct table_stats {
+    table_layout layout; // Current layout
+    long switches; // Number of layout changes since creation
+    long windows; // Number of completed windows
+    long searches; // Number of searches since creation
+    double hit_ratio; // Window: share of searches that found the key
+    double hit_depth; // Window: mean number of compares of a hit
+    double cost[TABLE_LAYOUTS]; // Window: estimated cost per search of each layout
+} table_stats;
+
+/**
+ * table_get_stats() - Get the statistics of a self-tuning table.
+ * @t: Table to inspect.
+ *
+ * Provided by: autotable.c.
+ *
+ * Returns: The statistics.
+ */
+table_stats table_get_stats(const table *t);
+
+/**
+ * entry_size_function - Function type for the size of a key/value pair.
+ * @key: The key.
+ * @value: The value.
+ *
+ * Returns: The number of bytes charged for the pair.
+ */
+typedef size_t entry_size_function(const void *key, const void *value);
+
+/**
+ * evict_function - Function type called for a key/value pair evicted from a table.
+ * @key: The evicted key.
+ * @value: The evicted value.
+ * @ctx: The context pointer given to table_set_evict().
+ *
+ * The function takes over the key and value; the kill functions of
+ * the table are not called for them.
+ *
+ * Returns: Nothing.
+ */
+typedef void evict_function(void *key, void *value, void *ctx);
+
+/**
+ * table_set_capacity() - Bound the size of a table.
+ * @t: Table to manipulate.
+ * @max_entries: Maximum number of entries, or 0 for no limit.
+ * @max_bytes: Maximum total size of the entries, or 0 for no limit.
+ * @size_func: Function giving the size of an entry. Must be set if
+ *             max_bytes is not 0.
+ *
+ * Turns the table into an LRU cache. Lookups, inserts and updates
+ * make a key the most recently used one. When an insert or update
+ * brings the table over a limit, the least recently used entries are
+ * evicted until it is within the limits again, as described for
+ * table_set_evict(). The entry just inserted or updated is never
+ * evicted, so a single entry larger than max_bytes is kept alone.
+ * Entries are evicted at once if the table is already over the new
+ * limits.
+ *
+ * Provided by: lrutable.c.
+ *
+ * Returns: Nothing.
+ */
+void table_set_capacity(table *t, int max_entries, size_t max_bytes,
+                        entry_size_function *size_func);
+
+/**
+ * table_set_evict() - Set the function called for evicted entries.
+ * @t: Table to manipulate.
+ * @evict_func: Function called for each evicted entry, or NULL.
+ * @ctx: Context pointer passed on to evict_func.
+ *
+ * Without an evict function, evicted keys and values are de-allocated
+ * with the kill functions of the table, as on remove.
+ *
+ * Provided by: lrutable.c.
+ *
+ * Returns: Nothing.
+ */
+void table_set_evict(table *t, evict_function *evict_func, void *ctx);
+
+/**
+ * hash_int() - Hash an int key.
+ * @key: Pointer to the int to hash.
+ *
+ * Defined in table_ext.c.
+ *
+ * Returns: The hash value of the key.
+ */
+unsigned long hash_int(const void *key);
+
+/**
+ * hash_string() - Hash a 0-terminated string key.
+ * @key: Pointer to the string to hash.
+ *
+ * Defined in table_ext.c.
+ *
+ * Returns: The hash value of the key.
+ */
+unsigned long hash_string(const void *key);
+
+#endif
@@ -0,0 +1,64 @@
+#include <stdlib.h>
+
+#include "table_ext.h"
+
+/*
+ * table_lookup_or_insert() from table_ext.h, for all tables that
+ * provide table_update().
+ *
+ * The function is kept out of table_ext.c, since programs that load
+ * the tables at run time link table_ext.c for the hash functions
+ * without linking any table.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version, moved from table_ext.c.
+ *   v1.1  2026-10-18: Keep present keys whose value is NULL.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+// Context of the update function of table_lookup_or_insert().
+struct make_args {
+    const void *key;
+    make_value_function *make_value;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * keep_or_make() - Update function of table_lookup_or_insert().
+ * @value: The current value of the key, or NULL if the key is absent.
+ * @present: True if the key is in the table.
+ * @ctx: A struct make_args.
+ *
+ * A present key keeps its value even if it is NULL, since the caller
+ * takes make_value being called to mean that the table took over key.
+ *
+ * Returns: The current value, or a new one from make_value.
+ */
+static void *keep_or_make(void *value, bool present, void *ctx)
+{
+    struct make_args *args = ctx;
+
+    if (present) {
+        return value;
+    }
+    return args->make_value(args->key);
+}
+
+// ==========INTERFACE==========
+
+/**
+ * table_lookup_or_insert() - Return the value of a key, inserting it if absent.
+ * @t: Table to manipulate.
+ * @key: Key to look up.
+ * @make_value: Function that creates the value of an absent key.
+ *
+ * Returns: The existing or newly inserted value.
+ */
+void *table_lookup_or_insert(table *t, void *key, make_value_function *make_value)
+{
+    struct make_args args = { key, make_value };
+
+    return table_update(t, key, keep_or_make, &args);
+}
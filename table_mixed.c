@@ -0,0 +1,330 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "bench_clock.h"
+#include "int_fixture.h"
+#include "table_backend.h"
+
+/**
+ * table_mixed.c - Compare the table backends on mixed read/write workloads.
+ *
+ * Compile with the loader and build each backend as a shared object
+ * as described in table_backend.h:
+ *
+ *   gcc -std=c11 -O2 -pthread -I<include> table_mixed.c table_backend.c table_ext.c \
+ *       bench_clock.c int_fixture.c -ldl
+ *
+ * Usage: table_mixed [-k keys] [-t budget_ms] [-r readers] backend.so...
+ *
+ * Each table starts with half of the int keys 0..keys-1 (default
+ * 10000). Half of the operations are lookups of random keys and half
+ * are writes, which remove a random key if it is present and insert
+ * it otherwise, so the table keeps its size. Every run lasts budget_ms
+ * (default 200).
+ *
+ * Two workloads are run per backend:
+ *  - single: one thread does the 50/50 mix; prints ns per operation.
+ *  - shared: one writer thread does the 50/50 mix while readers
+ *    (default 3) threads only look up keys; prints operations per
+ *    second of the writer and of all readers. Backends are shared
+ *    under a mutex taken by every operation ("locked"). A pthread
+ *    rwlock is not used since a stream of lookups starves its
+ *    writer. Backends that provide table_concurrent_lookup() are run
+ *    a second time with no lock at all ("lock-free"), which is how
+ *    they are meant to be used.
+ *
+ * With fewer cores than threads, the shared numbers mostly show the
+ * cost of the locking, not parallel speedup.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Clock helpers moved to bench_clock.c.
+ * 2026-10-18 v1.2: Use compare_int and next_random from int_fixture.c.
+ */
+
+#define DEFAULT_KEYS 10000
+#define DEFAULT_BUDGET_MS 200
+#define DEFAULT_READERS 3
+
+// Number of operations between clock reads. The writer of a shared
+// run may wait long for the lock, so it reads the clock more often.
+#define BATCH 256
+#define WRITER_BATCH 16
+
+// ===========INTERNAL DATA TYPES ============
+
+// State shared by the threads of one shared run.
+typedef struct shared_run {
+    const table_backend *b;
+    table *t;
+    int *keys;
+    int n_keys;
+    bool lock_readers; // Readers take the lock
+    pthread_mutex_t lock;
+    atomic_bool stop;
+} shared_run;
+
+// Arguments and result of one reader thread.
+typedef struct reader_arg {
+    shared_run *run;
+    unsigned seed;
+    long ops;
+} reader_arg;
+
+// Receives the number of successful lookups so that they are used.
+static volatile long sink;
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * fill() - Create a table holding every other key.
+ * @b: Backend to use.
+ * @keys: The keys 0..n_keys-1.
+ * @n_keys: Number of keys.
+ * @present: Set to true for the inserted keys.
+ *
+ * Returns: The table.
+ */
+static table *fill(const table_backend *b, int *keys, int n_keys, bool *present)
+{
+    table *t;
+
+    if (b->empty_hashed != NULL) {
+        t = b->empty_hashed(compare_int, hash_int, NULL, NULL);
+    } else {
+        t = b->empty(compare_int, NULL, NULL);
+    }
+    for (int i = 0; i < n_keys; i++) {
+        present[i] = i % 2 == 0;
+        if (present[i]) {
+            b->insert(t, &keys[i], &keys[i]);
+        }
+    }
+    return t;
+}
+
+/**
+ * mixed_op() - Do one operation of the 50/50 mix.
+ * @run: The run.
+ * @present: Which keys are in the table.
+ * @state: Generator state.
+ * @lock: Take the lock of the run.
+ *
+ * Returns: 1 if the operation was a successful lookup, otherwise 0.
+ */
+static int mixed_op(shared_run *run, bool *present, unsigned *state, bool lock)
+{
+    unsigned r = next_random(state);
+    int k = (r >> 1) % run->n_keys;
+    int found = 0;
+
+    if (r & 1) {
+        if (lock) {
+            pthread_mutex_lock(&run->lock);
+        }
+        found = run->b->lookup(run->t, &run->keys[k]) != NULL;
+    } else {
+        if (lock) {
+            pthread_mutex_lock(&run->lock);
+        }
+        if (present[k]) {
+            run->b->remove(run->t, &run->keys[k]);
+        } else {
+            run->b->insert(run->t, &run->keys[k], &run->keys[k]);
+        }
+        present[k] = !present[k];
+    }
+    if (lock) {
+        pthread_mutex_unlock(&run->lock);
+    }
+    return found;
+}
+
+/**
+ * single_run() - Run the 50/50 mix in one thread.
+ * @b: Backend to run.
+ * @keys: The keys.
+ * @n_keys: Number of keys.
+ * @budget_ns: Duration of the run.
+ *
+ * Returns: The mean time per operation in nanoseconds.
+ */
+static double single_run(const table_backend *b, int *keys, int n_keys, long long budget_ns)
+{
+    bool *present = malloc(n_keys * sizeof(bool));
+    shared_run run = { .b = b, .keys = keys, .n_keys = n_keys };
+    unsigned state = 1;
+    long ops = 0;
+    long found = 0;
+
+    run.t = fill(b, keys, n_keys, present);
+    long long start = now_ns();
+    long long ns = 0;
+    while (ns < budget_ns) {
+        for (int i = 0; i < BATCH; i++) {
+            found += mixed_op(&run, present, &state, false);
+        }
+        ops += BATCH;
+        ns = now_ns() - start;
+    }
+    sink = found;
+    b->kill(run.t);
+    free(present);
+    return (double)ns / ops;
+}
+
+// Internal function run by the reader threads of a shared run.
+static void *reader_thread(void *p)
+{
+    reader_arg *arg = p;
+    shared_run *run = arg->run;
+    unsigned state = arg->seed;
+    long found = 0;
+
+    while (!atomic_load_explicit(&run->stop, memory_order_relaxed)) {
+        for (int i = 0; i < BATCH; i++) {
+            int k = next_random(&state) % run->n_keys;
+            if (run->lock_readers) {
+                pthread_mutex_lock(&run->lock);
+            }
+            found += run->b->lookup(run->t, &run->keys[k]) != NULL;
+            if (run->lock_readers) {
+                pthread_mutex_unlock(&run->lock);
+            }
+        }
+        arg->ops += BATCH;
+    }
+    sink = found;
+    return NULL;
+}
+
+/**
+ * shared_run_backend() - Run one writer and a number of readers.
+ * @b: Backend to run.
+ * @keys: The keys.
+ * @n_keys: Number of keys.
+ * @n_readers: Number of reader threads.
+ * @lock_readers: Make the readers take the lock.
+ * @budget_ns: Duration of the run.
+ * @writer_ops: Set to the writer operations per second.
+ * @reader_ops: Set to the reader operations per second, all readers.
+ *
+ * The writer does the 50/50 mix. It takes the lock only if the
+ * readers do; as the only writer it needs no lock otherwise.
+ *
+ * Returns: Nothing.
+ */
+static void shared_run_backend(const table_backend *b, int *keys, int n_keys, int n_readers,
+                               bool lock_readers, long long budget_ns, double *writer_ops,
+                               double *reader_ops)
+{
+    bool *present = malloc(n_keys * sizeof(bool));
+    shared_run run = { .b = b, .keys = keys, .n_keys = n_keys, .lock_readers = lock_readers };
+    pthread_t *threads = malloc(n_readers * sizeof(pthread_t));
+    reader_arg *args = calloc(n_readers, sizeof(reader_arg));
+    unsigned state = 1;
+    long ops = 0;
+    long found = 0;
+
+    run.t = fill(b, keys, n_keys, present);
+    pthread_mutex_init(&run.lock, NULL);
+    atomic_init(&run.stop, false);
+    for (int i = 0; i < n_readers; i++) {
+        args[i].run = &run;
+        args[i].seed = 2 * i + 3;
+        pthread_create(&threads[i], NULL, reader_thread, &args[i]);
+    }
+
+    long long start = now_ns();
+    long long ns = 0;
+    while (ns < budget_ns) {
+        for (int i = 0; i < WRITER_BATCH; i++) {
+            found += mixed_op(&run, present, &state, lock_readers);
+        }
+        ops += WRITER_BATCH;
+        ns = now_ns() - start;
+    }
+    atomic_store(&run.stop, true);
+
+    long reads = 0;
+    for (int i = 0; i < n_readers; i++) {
+        pthread_join(threads[i], NULL);
+        reads += args[i].ops;
+    }
+    ns = now_ns() - start;
+    sink = found;
+
+    *writer_ops = ops * 1e9 / ns;
+    *reader_ops = reads * 1e9 / ns;
+
+    pthread_mutex_destroy(&run.lock);
+    b->kill(run.t);
+    free(present);
+    free(threads);
+    free(args);
+}
+
+int main(int argc, char *argv[])
+{
+    int n_keys = DEFAULT_KEYS;
+    int budget_ms = DEFAULT_BUDGET_MS;
+    int n_readers = DEFAULT_READERS;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "k:t:r:")) != -1) {
+        switch (opt) {
+        case 'k': n_keys = atoi(optarg);    break;
+        case 't': budget_ms = atoi(optarg); break;
+        case 'r': n_readers = atoi(optarg); break;
+        default:  n_keys = 0;               break;
+        }
+    }
+    int n_backends = argc - optind;
+    if (n_keys < 2 || budget_ms < 1 || n_readers < 0 || n_backends < 1) {
+        fprintf(stderr, "Usage: %s [-k keys] [-t budget_ms] [-r readers] backend.so...\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int *keys = malloc(n_keys * sizeof(int));
+    for (int i = 0; i < n_keys; i++) {
+        keys[i] = i;
+    }
+    long long budget_ns = budget_ms * 1000000LL;
+
+    printf("%d keys, 50%% lookups and 50%% writes, %d readers in the shared runs\n",
+           n_keys, n_readers);
+    printf("%-12s %14s %10s %16s %16s\n", "backend", "single ns/op", "shared", "writer ops/s",
+           "reader ops/s");
+    for (int i = 0; i < n_backends; i++) {
+        table_backend *b = table_backend_load(argv[optind + i]);
+        if (b == NULL) {
+            return EXIT_FAILURE;
+        }
+        double single = single_run(b, keys, n_keys, budget_ns);
+        double writer_ops;
+        double reader_ops;
+
+        shared_run_backend(b, keys, n_keys, n_readers, true, budget_ns, &writer_ops,
+                           &reader_ops);
+        printf("%-12s %14.1f %10s %16.0f %16.0f\n", b->name, single, "locked", writer_ops,
+               reader_ops);
+        if (b->concurrent_lookup != NULL && b->concurrent_lookup()) {
+            shared_run_backend(b, keys, n_keys, n_readers, false, budget_ns, &writer_ops,
+                               &reader_ops);
+            printf("%-12s %14s %10s %16.0f %16.0f\n", b->name, "", "lock-free", writer_ops,
+                   reader_ops);
+        }
+        fflush(stdout);
+        table_backend_unload(b);
+    }
+    free(keys);
+
+    return 0;
+}
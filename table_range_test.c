@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "table_ext.h"
+#include "int_fixture.h"
+
+/**
+ * table_range_test.c - Tests for the ordered tables.
+ *
+ * This file contains tests for table_range() and the key order kept by
+ * the ordered tables, sortedtable.c and skiptable.c. The plain table.h
+ * operations are covered by table_difftest.c. Each test terminates
+ * the program with an error message if it fails.
+ *
+ * Compile with: gcc -I<include> table_range_test.c sortedtable.c int_fixture.c
+ *          or: gcc -std=c11 -I<include> table_range_test.c skiptable.c int_fixture.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version, as sortedtable_test.c.
+ * 2026-10-18 v1.1: Renamed and used for skiptable.c too.
+ * 2026-10-18 v1.2: Use compare_int from int_fixture.c.
+ */
+
+#define N 1000
+
+// Range callback that appends the keys to an int array. ctx points to
+// the array, whose first element is the number of keys appended.
+static void collect(const void *key, void *value, void *ctx)
+{
+    int *out = ctx;
+    (void)value;
+    out[++out[0]] = *(const int *)key;
+}
+
+// Print callback that checks that the keys are ascending.
+static int last_printed = -1;
+static void check_order(const void *key, const void *value)
+{
+    (void)value;
+    int k = *(const int *)key;
+    if (k <= last_printed) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_print printed %d after %d.\n", k, last_printed);
+        exit(EXIT_FAILURE);
+    }
+    last_printed = k;
+}
+
+/**
+ * build() - Create a table of the even keys 0, 2, ..., 2 * (N - 1).
+ * @keys: Array of N keys, set by the function.
+ *
+ * The keys are inserted in a scrambled order.
+ *
+ * Returns: The table.
+ */
+static table *build(int *keys)
+{
+    table *t = table_empty(compare_int, NULL, NULL);
+
+    for (int i = 0; i < N; i++) {
+        // 379 and N are coprime, so this visits every index once.
+        int j = (i * 379) % N;
+        keys[j] = 2 * j;
+        table_insert(t, &keys[j], &keys[j]);
+    }
+    return t;
+}
+
+/**
+ * order_test() - Test that the entries are kept in ascending order.
+ */
+void order_test(void)
+{
+    fprintf(stderr, "Starting order_test()...");
+
+    int keys[N];
+    table *t = build(keys);
+
+    last_printed = -1;
+    table_print(t, check_order);
+    if (last_printed != 2 * (N - 1)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: the largest key printed was %d.\n", last_printed);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: the keys were printed in order.\n");
+    table_kill(t);
+}
+
+/**
+ * range_test() - Test table_range against a linear scan.
+ *
+ * Checks all ranges with bounds in [-2, 2 * N + 1], odd bounds
+ * falling between keys, and unbounded ranges.
+ */
+void range_test(void)
+{
+    fprintf(stderr, "Starting range_test()...");
+
+    int keys[N];
+    table *t = build(keys);
+    int *out = malloc((N + 1) * sizeof(int));
+
+    for (int lo = -2; lo <= 2 * N + 1; lo += 7) {
+        for (int hi = lo - 1; hi <= 2 * N + 1; hi += 5) {
+            out[0] = 0;
+            int n = table_range(t, &lo, &hi, collect, out);
+
+            // The expected keys are the even numbers in [lo, hi].
+            int first = lo <= 0 ? 0 : lo + lo % 2;
+            int expected = 0;
+            for (int k = first; k <= hi && k <= 2 * (N - 1); k += 2) {
+                expected++;
+                if (out[expected] != k) {
+                    // Fail with error message
+                    fprintf(stderr, "FAIL: range [%d, %d] visited %d, expected %d.\n",
+                            lo, hi, out[expected], k);
+                    exit(EXIT_FAILURE);
+                }
+            }
+            if (n != expected || out[0] != expected) {
+                // Fail with error message
+                fprintf(stderr, "FAIL: range [%d, %d] visited %d keys, expected %d.\n",
+                        lo, hi, n, expected);
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    int mid = N;
+    out[0] = 0;
+    int below = table_range(t, NULL, &mid, collect, out);
+    out[0] = 0;
+    int above = table_range(t, &mid, NULL, collect, out);
+    out[0] = 0;
+    int all = table_range(t, NULL, NULL, collect, out);
+    if (below != N / 2 + 1 || above != N / 2 || all != N) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: unbounded ranges visited %d, %d and %d keys.\n", below, above,
+                all);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: all ranges matched a linear scan.\n");
+    free(out);
+    table_kill(t);
+}
+
+/**
+ * remove_test() - Test that removals keep the order.
+ *
+ * Removes every other key and checks the remaining ones with
+ * table_range and table_lookup, then empties the table with
+ * table_choose_key.
+ */
+void remove_test(void)
+{
+    fprintf(stderr, "Starting remove_test()...");
+
+    int keys[N];
+    table *t = build(keys);
+    int *out = malloc((N + 1) * sizeof(int));
+
+    for (int k = 0; k < 2 * N; k += 4) {
+        table_remove(t, &k);
+    }
+    out[0] = 0;
+    int n = table_range(t, NULL, NULL, collect, out);
+    for (int i = 1; i <= n; i++) {
+        if (out[i] != 4 * i - 2) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: key %d found at position %d after removals.\n", out[i], i);
+            exit(EXIT_FAILURE);
+        }
+    }
+    int absent = 4;
+    int present = 6;
+    if (n != N / 2 || table_lookup(t, &absent) != NULL || table_lookup(t, &present) == NULL) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: wrong contents after removals.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    while (!table_is_empty(t)) {
+        table_remove(t, table_choose_key(t));
+        n--;
+    }
+    if (n != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: %d keys left after emptying the table.\n", n);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: removals kept the keys in order.\n");
+    free(out);
+    table_kill(t);
+}
+
+int main(void)
+{
+    order_test();       // Test the key order
+    range_test();       // Test table_range
+    remove_test();      // Test removals
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
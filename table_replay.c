@@ -0,0 +1,251 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bench_clock.h"
+#include "table_backend.h"
+#include "table_trace.h"
+#include "histogram.h"
+
+/**
+ * table_replay.c - Replay a recorded table trace against table backends.
+ *
+ * Compile with the loader and build each backend as a shared object
+ * as described in table_backend.h:
+ *
+ *   gcc -O2 -I<include> table_replay.c table_trace_load.c table_backend.c table_ext.c \
+ *       histogram.c bench_clock.c -ldl
+ *
+ * Usage: table_replay [-r repetitions] trace backend.so...
+ *
+ * The trace is recorded with table_trace.h. Each distinct key hash in
+ * the trace becomes one unsigned long key whose value is the hash;
+ * backends that provide table_empty_hashed() use it as the hash. The
+ * keys are allocated before the replay and the tables get no kill
+ * functions.
+ *
+ * For each backend, the whole trace is replayed repetitions times
+ * (default 3) on a new table, and the fastest run is reported as
+ * ns/op and Mops/s. A final run times every operation separately, and
+ * the latency percentiles p50, p90, p99, p99.9 and the maximum are
+ * printed per operation kind, minus the overhead of reading the clock.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Latencies are recorded in histograms instead of sorted.
+ * 2026-10-18 v1.2: Clock helpers moved to bench_clock.c.
+ */
+
+#define DEFAULT_REPETITIONS 3
+
+#define NUM_OPS 3
+static const char *op_names[NUM_OPS] = { "insert", "lookup", "remove" };
+
+// A trace prepared for replay: the records refer to keys by address.
+typedef struct replay {
+    size_t n;
+    table_trace_op *ops;
+    unsigned long **keys; // keys[i] is the key of record i
+    unsigned long *distinct; // The distinct keys, sorted
+    size_t n_distinct;
+} replay;
+
+// Receives the number of successful lookups so that they are used.
+static volatile long sink;
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+// Internal function to compare two keys, also used by qsort.
+static int compare_keys(const void *a, const void *b)
+{
+    unsigned long x = *(const unsigned long *)a;
+    unsigned long y = *(const unsigned long *)b;
+    return (x > y) - (x < y);
+}
+
+// Internal function to hash a key. The key already is a hash.
+static unsigned long hash_key(const void *key)
+{
+    return *(const unsigned long *)key;
+}
+
+/**
+ * prepare() - Map the key hashes of a trace to distinct key objects.
+ * @records: Records of the trace.
+ * @n: Number of records.
+ *
+ * Returns: The prepared trace.
+ */
+static replay prepare(const table_trace_record *records, size_t n)
+{
+    replay r = { .n = n };
+
+    r.ops = malloc((n + 1) * sizeof(*r.ops));
+    r.keys = malloc((n + 1) * sizeof(*r.keys));
+    r.distinct = malloc((n + 1) * sizeof(*r.distinct));
+    for (size_t i = 0; i < n; i++) {
+        r.distinct[i] = records[i].key;
+    }
+    qsort(r.distinct, n, sizeof(*r.distinct), compare_keys);
+    for (size_t i = 0; i < n; i++) {
+        if (r.n_distinct == 0 || r.distinct[r.n_distinct - 1] != r.distinct[i]) {
+            r.distinct[r.n_distinct++] = r.distinct[i];
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        r.ops[i] = records[i].op;
+        r.keys[i] = bsearch(&records[i].key, r.distinct, r.n_distinct, sizeof(*r.distinct),
+                            compare_keys);
+    }
+    return r;
+}
+
+// Internal function to create a table for a replay.
+static table *new_table(const table_backend *b)
+{
+    if (b->empty_hashed != NULL) {
+        return b->empty_hashed(compare_keys, hash_key, NULL, NULL);
+    }
+    return b->empty(compare_keys, NULL, NULL);
+}
+
+/**
+ * apply() - Apply one record of a trace to a table.
+ * @b: Backend of the table.
+ * @t: Table.
+ * @r: Prepared trace.
+ * @i: Index of the record.
+ *
+ * Returns: 1 if the record is a lookup that found a value, otherwise 0.
+ */
+static int apply(const table_backend *b, table *t, const replay *r, size_t i)
+{
+    switch (r->ops[i]) {
+    case TABLE_TRACE_INSERT:
+        b->insert(t, r->keys[i], r->keys[i]);
+        return 0;
+    case TABLE_TRACE_LOOKUP:
+        return b->lookup(t, r->keys[i]) != NULL;
+    case TABLE_TRACE_REMOVE:
+        b->remove(t, r->keys[i]);
+        return 0;
+    }
+    return 0;
+}
+
+/**
+ * throughput_run() - Replay a trace without timing single operations.
+ * @b: Backend to run.
+ * @r: Prepared trace.
+ *
+ * Returns: The elapsed time in nanoseconds, including table_empty and
+ *          table_kill.
+ */
+static long long throughput_run(const table_backend *b, const replay *r)
+{
+    long found = 0;
+
+    long long start = now_ns();
+    table *t = new_table(b);
+    for (size_t i = 0; i < r->n; i++) {
+        found += apply(b, t, r, i);
+    }
+    b->kill(t);
+    long long ns = now_ns() - start;
+
+    sink = found;
+    return ns;
+}
+
+/**
+ * latency_run() - Replay a trace and print latency percentiles.
+ * @b: Backend to run.
+ * @r: Prepared trace.
+ *
+ * Returns: Nothing.
+ */
+static void latency_run(const table_backend *b, const replay *r)
+{
+    long long overhead = clock_overhead();
+    histogram *h[NUM_OPS];
+    long found = 0;
+
+    for (int op = 0; op < NUM_OPS; op++) {
+        h[op] = histogram_empty();
+    }
+    table *t = new_table(b);
+    for (size_t i = 0; i < r->n; i++) {
+        long long start = now_ns();
+        found += apply(b, t, r, i);
+        histogram_record(h[r->ops[i]], now_ns() - start - overhead);
+    }
+    b->kill(t);
+    sink = found;
+
+    for (int op = 0; op < NUM_OPS; op++) {
+        char buf[256];
+        if (histogram_count(h[op]) > 0) {
+            printf("  %-12s %-6s n=%-9lld %s ns\n", b->name, op_names[op],
+                   histogram_count(h[op]), histogram_format(h[op], buf, sizeof(buf)));
+        }
+        histogram_kill(h[op]);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int repetitions = DEFAULT_REPETITIONS;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:")) != -1) {
+        switch (opt) {
+        case 'r': repetitions = atoi(optarg); break;
+        default:  repetitions = 0;            break;
+        }
+    }
+    if (repetitions < 1 || argc - optind < 2) {
+        fprintf(stderr, "Usage: %s [-r repetitions] trace backend.so...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    size_t n;
+    table_trace_record *records = table_trace_load(argv[optind], &n);
+    if (records == NULL) {
+        return EXIT_FAILURE;
+    }
+    replay r = prepare(records, n);
+    free(records);
+
+    size_t counts[NUM_OPS] = { 0 };
+    for (size_t i = 0; i < n; i++) {
+        counts[r.ops[i]]++;
+    }
+    printf("trace %s: %zu ops, %zu keys, %zu inserts, %zu lookups, %zu removes\n",
+           argv[optind], n, r.n_distinct, counts[TABLE_TRACE_INSERT],
+           counts[TABLE_TRACE_LOOKUP], counts[TABLE_TRACE_REMOVE]);
+
+    for (int i = optind + 1; i < argc; i++) {
+        table_backend *b = table_backend_load(argv[i]);
+        if (b == NULL) {
+            return EXIT_FAILURE;
+        }
+        long long best = -1;
+        for (int rep = 0; rep < repetitions; rep++) {
+            long long ns = throughput_run(b, &r);
+            if (best < 0 || ns < best) {
+                best = ns;
+            }
+        }
+        printf("  %-12s total  %9.3f ms %8.2f ns/op %8.2f Mops/s\n", b->name, best / 1e6,
+               n > 0 ? (double)best / n : 0.0, best > 0 ? n * 1e3 / best : 0.0);
+        latency_run(b, &r);
+        table_backend_unload(b);
+    }
+
+    free(r.ops);
+    free(r.keys);
+    free(r.distinct);
+    return 0;
+}
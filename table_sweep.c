@@ -0,0 +1,322 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "bench_clock.h"
+#include "int_fixture.h"
+#include "table_backend.h"
+
+/**
+ * table_sweep.c - Find the table sizes and skews where the fastest backend changes.
+ *
+ * Compile with the loader and build each backend as a shared object
+ * as described in table_backend.h:
+ *
+ *   gcc -O2 -I<include> table_sweep.c table_backend.c table_ext.c bench_clock.c \
+ *       int_fixture.c -lm -ldl
+ *
+ * Usage: table_sweep [-m max_size] [-t budget_ms] backend.so...
+ *
+ * For every size 10, 100, ... up to max_size (default 10^6) and every
+ * skew in SKEWS, each backend builds a table of size int keys inserted
+ * in random order and then looks up keys drawn from a Zipf
+ * distribution with that exponent; skew 0 is uniform. The popular keys
+ * are spread randomly over the insertion order. Lookups run in batches
+ * of growing size until budget_ms (default 100) has passed or
+ * MAX_LOOKUPS lookups are done, and the mean lookup time is the result
+ * of the cell.
+ *
+ * The tables that scan an array on insert need quadratic time to
+ * build large tables. A backend whose build takes longer than
+ * BUILD_FACTOR budgets is stopped and skipped for the rest of the
+ * sweep. Skipped cells are shown as "-".
+ *
+ * The output has three parts:
+ *  - one CSV line size,skew,backend,ns_per_lookup per cell,
+ *  - a grid naming the fastest backend of every size and skew,
+ *  - for each skew, the sizes at which the fastest backend changes.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Clock helpers moved to bench_clock.c.
+ * 2026-10-18 v1.2: Use compare_int and next_random from int_fixture.c.
+ */
+
+#define DEFAULT_MAX_SIZE 1000000
+#define DEFAULT_BUDGET_MS 100
+
+// Zipf exponents of the sweep, from uniform to heavily skewed.
+static const double SKEWS[] = { 0.0, 0.6, 0.8, 1.0, 1.2 };
+#define NUM_SKEWS ((int)(sizeof(SKEWS) / sizeof(SKEWS[0])))
+
+// Number of precomputed lookup keys per cell, the largest number of
+// lookups per batch and per cell.
+#define SEQUENCE_LENGTH 65536
+#define MAX_BATCH 1024
+#define MAX_LOOKUPS 1000000
+
+// A build that takes longer than BUILD_FACTOR budgets ends the sweep
+// of its backend.
+#define BUILD_FACTOR 100
+
+// Receives the number of successful lookups so that they are used.
+static volatile long sink;
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+// Internal function to shuffle an array of ints.
+static void shuffle(int *a, int n, unsigned *state)
+{
+    for (int i = n - 1; i > 0; i--) {
+        int j = next_random(state) % (i + 1);
+        int tmp = a[i];
+        a[i] = a[j];
+        a[j] = tmp;
+    }
+}
+
+/**
+ * zipf_sequence() - Draw lookup keys from a Zipf distribution.
+ * @size: Number of keys.
+ * @skew: Zipf exponent; 0 gives the uniform distribution.
+ * @by_rank: by_rank[r] is the key of rank r, r = 0 is the most popular.
+ * @seq: Set to SEQUENCE_LENGTH keys.
+ * @state: Generator state.
+ *
+ * Returns: Nothing.
+ */
+static void zipf_sequence(int size, double skew, const int *by_rank, int *seq,
+                          unsigned *state)
+{
+    double *cdf = malloc(size * sizeof(double));
+    double sum = 0.0;
+
+    for (int r = 0; r < size; r++) {
+        sum += 1.0 / pow(r + 1, skew);
+        cdf[r] = sum;
+    }
+    for (int i = 0; i < SEQUENCE_LENGTH; i++) {
+        double u = (double)next_random(state) / 4294967296.0 * sum;
+        // Find the first rank whose cumulative weight exceeds u.
+        int lo = 0;
+        int hi = size - 1;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (cdf[mid] > u) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        seq[i] = by_rank[lo];
+    }
+    free(cdf);
+}
+
+/**
+ * run_cell() - Measure one backend at one size and skew.
+ * @b: Backend to run.
+ * @keys: The keys 0..size-1, in insertion order.
+ * @size: Number of keys.
+ * @seq: SEQUENCE_LENGTH lookup keys.
+ * @budget_ns: Time budget of the lookups.
+ *
+ * The lookup batches start with one lookup and double up to MAX_BATCH,
+ * so that a slow table does not overrun the budget by much and a fast
+ * one reads the clock rarely.
+ *
+ * Returns: The mean lookup time in nanoseconds, or -1 if the build
+ *          took longer than BUILD_FACTOR budgets.
+ */
+static double run_cell(const table_backend *b, int *keys, int size, int *seq,
+                       long long budget_ns)
+{
+    long long limit = budget_ns * BUILD_FACTOR;
+    table *t;
+
+    if (b->empty_hashed != NULL) {
+        t = b->empty_hashed(compare_int, hash_int, NULL, NULL);
+    } else {
+        t = b->empty(compare_int, NULL, NULL);
+    }
+
+    long long start = now_ns();
+    for (int i = 0; i < size; i++) {
+        b->insert(t, &keys[i], &keys[i]);
+        if (i % MAX_BATCH == MAX_BATCH - 1 && now_ns() - start > limit) {
+            b->kill(t);
+            return -1;
+        }
+    }
+
+    long found = 0;
+    long lookups = 0;
+    int batch = 1;
+    int pos = 0;
+    start = now_ns();
+    long long ns = 0;
+    while (lookups < MAX_LOOKUPS && ns < budget_ns) {
+        for (int i = 0; i < batch; i++) {
+            found += b->lookup(t, &seq[pos]) != NULL;
+            pos = (pos + 1) % SEQUENCE_LENGTH;
+        }
+        lookups += batch;
+        ns = now_ns() - start;
+        if (batch < MAX_BATCH) {
+            batch *= 2;
+        }
+    }
+    sink = found;
+    b->kill(t);
+
+    if (found != lookups) {
+        fprintf(stderr, "%s: %ld of %ld lookups found their key\n", b->name, found, lookups);
+    }
+    return (double)ns / lookups;
+}
+
+/**
+ * fastest() - Return the index of the fastest backend of a cell.
+ * @ns: Mean lookup time of each backend, or -1 if skipped.
+ * @n_backends: Number of backends.
+ *
+ * Returns: The index, or -1 if all backends were skipped.
+ */
+static int fastest(const double *ns, int n_backends)
+{
+    int best = -1;
+
+    for (int i = 0; i < n_backends; i++) {
+        if (ns[i] >= 0 && (best < 0 || ns[i] < ns[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_size = DEFAULT_MAX_SIZE;
+    int budget_ms = DEFAULT_BUDGET_MS;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "m:t:")) != -1) {
+        switch (opt) {
+        case 'm': max_size = atoi(optarg);  break;
+        case 't': budget_ms = atoi(optarg); break;
+        default:  max_size = 0;             break;
+        }
+    }
+    int n_backends = argc - optind;
+    if (max_size < 10 || budget_ms < 1 || n_backends < 1) {
+        fprintf(stderr, "Usage: %s [-m max_size] [-t budget_ms] backend.so...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    table_backend **backends = malloc(n_backends * sizeof(*backends));
+    for (int i = 0; i < n_backends; i++) {
+        backends[i] = table_backend_load(argv[optind + i]);
+        if (backends[i] == NULL) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    int n_sizes = 0;
+    for (long size = 10; size <= max_size; size *= 10) {
+        n_sizes++;
+    }
+    // results[(s * NUM_SKEWS + k) * n_backends + b] is the time of a cell.
+    double *results = malloc(n_sizes * NUM_SKEWS * n_backends * sizeof(double));
+    bool *skipped = calloc(n_backends, sizeof(bool));
+    int *keys = malloc(max_size * sizeof(int));
+    int *by_rank = malloc(max_size * sizeof(int));
+    int *seq = malloc(SEQUENCE_LENGTH * sizeof(int));
+    unsigned state = 1;
+
+    printf("size,skew,backend,ns_per_lookup\n");
+    int size = 10;
+    for (int s = 0; s < n_sizes; s++, size *= 10) {
+        for (int i = 0; i < size; i++) {
+            keys[i] = i;
+            by_rank[i] = i;
+        }
+        shuffle(keys, size, &state);
+        shuffle(by_rank, size, &state);
+
+        for (int k = 0; k < NUM_SKEWS; k++) {
+            zipf_sequence(size, SKEWS[k], by_rank, seq, &state);
+            for (int b = 0; b < n_backends; b++) {
+                double *ns = &results[(s * NUM_SKEWS + k) * n_backends + b];
+                *ns = -1;
+                if (!skipped[b]) {
+                    *ns = run_cell(backends[b], keys, size, seq, budget_ms * 1000000LL);
+                    skipped[b] = *ns < 0;
+                }
+                if (*ns >= 0) {
+                    printf("%d,%.1f,%s,%.2f\n", size, SKEWS[k], backends[b]->name, *ns);
+                } else {
+                    printf("%d,%.1f,%s,-\n", size, SKEWS[k], backends[b]->name);
+                }
+                fflush(stdout);
+            }
+        }
+    }
+
+    // The grid of fastest backends.
+    printf("\nfastest backend (ns/lookup) per size and skew\n%-8s", "size");
+    for (int k = 0; k < NUM_SKEWS; k++) {
+        char label[32];
+        snprintf(label, sizeof(label), "skew %.1f", SKEWS[k]);
+        printf(" %-20s", label);
+    }
+    printf("\n");
+    size = 10;
+    for (int s = 0; s < n_sizes; s++, size *= 10) {
+        printf("%-8d", size);
+        for (int k = 0; k < NUM_SKEWS; k++) {
+            const double *ns = &results[(s * NUM_SKEWS + k) * n_backends];
+            int best = fastest(ns, n_backends);
+            char cell[64];
+            if (best < 0) {
+                snprintf(cell, sizeof(cell), "-");
+            } else {
+                snprintf(cell, sizeof(cell), "%s (%.1f)", backends[best]->name, ns[best]);
+            }
+            printf(" %-20s", cell);
+        }
+        printf("\n");
+    }
+
+    // The crossover points of each skew.
+    printf("\ncrossovers\n");
+    for (int k = 0; k < NUM_SKEWS; k++) {
+        int prev = -1;
+        printf("skew %.1f:", SKEWS[k]);
+        size = 10;
+        for (int s = 0; s < n_sizes; s++, size *= 10) {
+            int best = fastest(&results[(s * NUM_SKEWS + k) * n_backends], n_backends);
+            if (best != prev) {
+                printf(" %s from %d", best >= 0 ? backends[best]->name : "-", size);
+                prev = best;
+            }
+        }
+        printf("\n");
+    }
+
+    for (int i = 0; i < n_backends; i++) {
+        table_backend_unload(backends[i]);
+    }
+    free(backends);
+    free(results);
+    free(skipped);
+    free(keys);
+    free(by_rank);
+    free(seq);
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+#ifndef TABLE_TRACE_H
+#define TABLE_TRACE_H
+
+#include <stddef.h>
+
+#include "table_ext.h"
+
+/*
+ * Recording of table operations to a trace file, and loading of
+ * traces for replay.
+ *
+ * A program records its table workload by calling table_trace_insert(),
+ * table_trace_lookup() and table_trace_remove() instead of the
+ * table.h functions. Each call performs the operation on the table
+ * and appends a record to the trace. Keys are stored as their hash,
+ * computed by the hash function given to table_trace_open(), so the
+ * trace holds no key contents and works for any key type. Two keys
+ * with the same hash are the same key in the trace. The tool
+ * table_replay runs a trace against any table backend.
+ *
+ * File format: the four bytes "TTR1" followed by one 8-byte record
+ * per operation, least significant byte first. The low two bits of a
+ * record are the operation and the high 62 bits the key hash, with
+ * the top two bits of the hash dropped.
+ *
+ * A recorder must only be used by one thread at a time. Programs that
+ * only load traces link table_trace_load.c, and need no table
+ * implementation.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// Magic bytes at the start of a trace file, and the size of a record.
+#define TABLE_TRACE_MAGIC "TTR1"
+#define TABLE_TRACE_MAGIC_SIZE 4
+#define TABLE_TRACE_RECORD_SIZE 8
+
+// ==========PUBLIC DATA TYPES============
+
+typedef struct table_trace table_trace;
+
+// The operations in a trace.
+typedef enum table_trace_op {
+    TABLE_TRACE_INSERT,
+    TABLE_TRACE_LOOKUP,
+    TABLE_TRACE_REMOVE,
+} table_trace_op;
+
+// One decoded record of a trace.
+typedef struct table_trace_record {
+    table_trace_op op;
+    unsigned long key; // Hash of the key, at most 62 bits
+} table_trace_record;
+
+// ==========RECORDING INTERFACE==========
+
+/**
+ * table_trace_open() - Create a trace file for recording.
+ * @path: Path of the file. An existing file is overwritten.
+ * @key_hash_func: A pointer to a function to be used to hash keys.
+ *
+ * Returns: A pointer to the new recorder, or NULL with a message on
+ * stderr if the file could not be created.
+ */
+table_trace *table_trace_open(const char *path, hash_function *key_hash_func);
+
+/**
+ * table_trace_insert() - Insert a key/value pair and record the insert.
+ * @tr: Recorder.
+ * @t: Table to manipulate.
+ * @key: Key, passed on to table_insert().
+ * @value: Value, passed on to table_insert().
+ *
+ * Returns: Nothing.
+ */
+void table_trace_insert(table_trace *tr, table *t, void *key, void *value);
+
+/**
+ * table_trace_lookup() - Look up a key and record the lookup.
+ * @tr: Recorder.
+ * @t: Table to inspect.
+ * @key: Key to look up.
+ *
+ * Returns: The result of table_lookup().
+ */
+void *table_trace_lookup(table_trace *tr, const table *t, const void *key);
+
+/**
+ * table_trace_remove() - Remove a key and record the remove.
+ * @tr: Recorder.
+ * @t: Table to manipulate.
+ * @key: Key to remove.
+ *
+ * The key is hashed before the remove, since the remove may kill it.
+ *
+ * Returns: Nothing.
+ */
+void table_trace_remove(table_trace *tr, table *t, const void *key);
+
+/**
+ * table_trace_close() - Flush and close a trace file.
+ * @tr: Recorder to close.
+ *
+ * Returns: 0 if all records were written, otherwise -1 with a message
+ * on stderr.
+ */
+int table_trace_close(table_trace *tr);
+
+// ==========LOADING INTERFACE==========
+
+/**
+ * table_trace_load() - Read all records of a trace file.
+ * @path: Path of the file.
+ * @n: Set to the number of records.
+ *
+ * Returns: A new array of records that the caller frees with free(),
+ * or NULL with a message on stderr if the file could not be read or
+ * is not a trace. An empty trace gives a non-NULL array and *n = 0.
+ */
+table_trace_record *table_trace_load(const char *path, size_t *n);
+
+#endif
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "table_trace.h"
+
+/*
+ * Loading of table traces, see table_trace.h.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========LOADING INTERFACE==========
+
+/**
+ * table_trace_load() - Read all records of a trace file.
+ * @path: Path of the file.
+ * @n: Set to the number of records.
+ *
+ * Returns: A new array of records that the caller frees with free(),
+ * or NULL with a message on stderr if the file could not be read or
+ * is not a trace. An empty trace gives a non-NULL array and *n = 0.
+ */
+table_trace_record *table_trace_load(const char *path, size_t *n)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+
+    char magic[TABLE_TRACE_MAGIC_SIZE];
+    if (fread(magic, TABLE_TRACE_MAGIC_SIZE, 1, f) != 1
+        || memcmp(magic, TABLE_TRACE_MAGIC, TABLE_TRACE_MAGIC_SIZE) != 0) {
+        fprintf(stderr, "%s: not a table trace\n", path);
+        fclose(f);
+        return NULL;
+    }
+
+    size_t capacity = 1024;
+    size_t count = 0;
+    table_trace_record *records = malloc(capacity * sizeof(*records));
+    unsigned char bytes[TABLE_TRACE_RECORD_SIZE];
+    size_t got;
+
+    while ((got = fread(bytes, 1, TABLE_TRACE_RECORD_SIZE, f)) == TABLE_TRACE_RECORD_SIZE) {
+        uint64_t r = 0;
+        for (int i = 0; i < TABLE_TRACE_RECORD_SIZE; i++) {
+            r |= (uint64_t)bytes[i] << (8 * i);
+        }
+        if ((r & 3) > TABLE_TRACE_REMOVE) {
+            fprintf(stderr, "%s: bad operation in record %zu\n", path, count);
+            break;
+        }
+        if (count == capacity) {
+            capacity *= 2;
+            records = realloc(records, capacity * sizeof(*records));
+        }
+        records[count].op = (table_trace_op)(r & 3);
+        records[count].key = (unsigned long)(r >> 2);
+        count++;
+    }
+    bool ok = got == 0 && !ferror(f);
+    if (got != 0 && got != TABLE_TRACE_RECORD_SIZE) {
+        fprintf(stderr, "%s: truncated record after %zu records\n", path, count);
+    } else if (ferror(f)) {
+        perror(path);
+    }
+    fclose(f);
+
+    if (!ok) {
+        free(records);
+        return NULL;
+    }
+    *n = count;
+    return records;
+}
@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "int_fixture.h"
+#include "table_trace.h"
+
+/**
+ * table_trace_test.c - Tests for the table trace recorder and loader.
+ *
+ * This file contains tests for the functions declared in
+ * table_trace.h. Each test terminates the program with an error
+ * message if it fails. The trace files are written to the current
+ * directory and removed again.
+ *
+ * Compile with any implementation of table.h, e.g.:
+ *
+ *   gcc -I<include> table_trace_test.c table_trace.c table_trace_load.c \
+ *       table_ext.c int_fixture.c table.c dlist.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Use compare_int from int_fixture.c.
+ */
+
+#define TRACE_PATH "table_trace_test.trace"
+
+// Internal function passed to the tables.
+static unsigned long identity_hash(const void *key)
+{
+    return (unsigned long)*(const int *)key;
+}
+
+/**
+ * record_test() - Test that recorded operations are loaded back.
+ *
+ * Records inserts, lookups and removes on a table, checks that the
+ * operations were performed, and checks that the loaded trace holds
+ * the same operations and keys in the same order.
+ */
+void record_test(void)
+{
+    fprintf(stderr, "Starting record_test()...");
+
+    int keys[3] = { 5, 7, 1 << 30 };
+    int values[3] = { 50, 70, 300 };
+    table_trace_record expected[7] = {
+        { TABLE_TRACE_INSERT, 5 },
+        { TABLE_TRACE_INSERT, 7 },
+        { TABLE_TRACE_INSERT, 1 << 30 },
+        { TABLE_TRACE_LOOKUP, 7 },
+        { TABLE_TRACE_REMOVE, 7 },
+        { TABLE_TRACE_LOOKUP, 7 },
+        { TABLE_TRACE_LOOKUP, 1 << 30 },
+    };
+
+    table *t = table_empty(compare_int, NULL, NULL);
+    table_trace *tr = table_trace_open(TRACE_PATH, identity_hash);
+    if (tr == NULL) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_trace_open could not create %s.\n", TRACE_PATH);
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < 3; i++) {
+        table_trace_insert(tr, t, &keys[i], &values[i]);
+    }
+    int *v = table_trace_lookup(tr, t, &keys[1]);
+    table_trace_remove(tr, t, &keys[1]);
+    int *gone = table_trace_lookup(tr, t, &keys[1]);
+    int *last = table_trace_lookup(tr, t, &keys[2]);
+    if (v != &values[1] || gone != NULL || last != &values[2]) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: the traced operations gave wrong results.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (table_trace_close(tr) != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_trace_close reported an error.\n");
+        exit(EXIT_FAILURE);
+    }
+    table_kill(t);
+
+    size_t n;
+    table_trace_record *records = table_trace_load(TRACE_PATH, &n);
+    if (records == NULL || n != 7) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_trace_load did not return 7 records.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (records[i].op != expected[i].op || records[i].key != expected[i].key) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: record %zu is op %d key %lu, expected op %d key %lu.\n", i,
+                    records[i].op, records[i].key, expected[i].op, expected[i].key);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    fprintf(stderr, "Test succeeded: the loaded trace matches the recorded operations.\n");
+    free(records);
+    remove(TRACE_PATH);
+}
+
+/**
+ * empty_trace_test() - Test loading a trace without records.
+ */
+void empty_trace_test(void)
+{
+    fprintf(stderr, "Starting empty_trace_test()...");
+
+    table_trace *tr = table_trace_open(TRACE_PATH, identity_hash);
+    table_trace_close(tr);
+
+    size_t n = 1;
+    table_trace_record *records = table_trace_load(TRACE_PATH, &n);
+    if (records == NULL || n != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_trace_load failed on an empty trace.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: an empty trace has no records.\n");
+    free(records);
+    remove(TRACE_PATH);
+}
+
+/**
+ * bad_file_test() - Test that files that are not traces are rejected.
+ *
+ * Checks a file with the wrong magic and a trace with a truncated
+ * record. Both give a message on stderr.
+ */
+void bad_file_test(void)
+{
+    fprintf(stderr, "Starting bad_file_test()...\n");
+
+    size_t n;
+    FILE *f = fopen(TRACE_PATH, "wb");
+    fputs("not a trace", f);
+    fclose(f);
+    if (table_trace_load(TRACE_PATH, &n) != NULL) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_trace_load accepted a file with the wrong magic.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    f = fopen(TRACE_PATH, "wb");
+    fputs("TTR1", f);
+    fwrite("\0\0\0\0\0\0\0\0\0\0\0", 11, 1, f);
+    fclose(f);
+    if (table_trace_load(TRACE_PATH, &n) != NULL) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_trace_load accepted a truncated record.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: table_trace_load rejected the bad files.\n");
+    remove(TRACE_PATH);
+}
+
+int main(void)
+{
+    record_test();      // Test recording and loading
+    empty_trace_test(); // Test a trace without records
+    bad_file_test();    // Test rejection of bad files
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
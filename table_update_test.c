@@ -0,0 +1,415 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "table_ext.h"
+#include "int_fixture.h"
+
+/**
+ * table_update_test.c - Tests for table_update() in table_ext.h.
+ *
+ * This file contains tests for table_update() and
+ * table_lookup_or_insert(). It is linked with one of the table
+ * implementations and table_lookup_or_insert.c, e.g.
+ *
+ *   gcc -I<include> table_update_test.c int_fixture.c arraytable.c \
+ *       table_lookup_or_insert.c array_1d.c
+ *   gcc -I<include> table_update_test.c int_fixture.c hashtable.c table_ext.c \
+ *       table_lookup_or_insert.c dlist.c array_1d.c
+ *
+ * Each test terminates the program with an error message if it fails.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Added tests of table_lookup_or_insert.
+ * 2026-10-18 v1.2: Added null_value_test().
+ * 2026-10-18 v1.3: Use compare_int and new_int from int_fixture.c.
+ */
+
+// Number of times the compare function was called, and the number of
+// keys and values killed by the table, and the number of values made
+// by make_zero().
+static int compares = 0;
+static int makes = 0;
+static int key_kills = 0;
+static int value_kills = 0;
+
+// Internal functions passed to the tables. The keys are compared with
+// compare_int() and the calls are counted.
+static int count_compares(const void *a, const void *b)
+{
+    compares++;
+    return compare_int(a, b);
+}
+
+static void kill_key(void *k)
+{
+    key_kills++;
+    free(k);
+}
+
+static void kill_value(void *v)
+{
+    value_kills++;
+    free(v);
+}
+
+// Update functions. increment() adds 1 in place and inserts a count of
+// 1 for an absent key, replace() returns the new value in ctx, and
+// only_present() never inserts.
+static void *increment(void *value, bool present, void *ctx)
+{
+    (void)ctx;
+    if (!present) {
+        return new_int(1);
+    }
+    (*(int *)value)++;
+    return value;
+}
+
+static void *replace(void *value, bool present, void *ctx)
+{
+    (void)value;
+    (void)present;
+    return ctx;
+}
+
+static void *only_present(void *value, bool present, void *ctx)
+{
+    (void)ctx;
+    if (present) {
+        (*(int *)value) += 10;
+    }
+    return value;
+}
+
+// Update function that replaces the value with ctx only if the key
+// is present.
+static void *replace_if_present(void *value, bool present, void *ctx)
+{
+    return present ? ctx : value;
+}
+
+// Value function of table_lookup_or_insert() that creates a 0.
+static void *make_zero(const void *key)
+{
+    (void)key;
+    makes++;
+    return new_int(0);
+}
+
+/**
+ * count_test() - Test counting with table_update.
+ *
+ * Counts the occurrences of keys with increment(). The table takes
+ * over the key of the first update of each key; the caller frees the
+ * keys of the other updates.
+ */
+void count_test(void)
+{
+    fprintf(stderr, "Starting count_test()...");
+
+    table *t = table_empty(count_compares, kill_key, kill_value);
+    int input[8] = { 3, 1, 3, 2, 3, 1, 3, 5 };
+
+    for (int i = 0; i < 8; i++) {
+        int *k = new_int(input[i]);
+        int *v = table_update(t, k, increment, NULL);
+        if (*v == 1) {
+            // New key: the table owns k now.
+            continue;
+        }
+        free(k);
+    }
+
+    int expected[6] = { 0, 2, 1, 4, 0, 1 };
+    for (int k = 0; k < 6; k++) {
+        int *v = table_lookup(t, &k);
+        int count = v == NULL ? 0 : *v;
+        if (count != expected[k]) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: key %d was counted %d times, expected %d.\n", k, count,
+                    expected[k]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (value_kills != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: an in-place update killed the value.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    if (key_kills != 4 || value_kills != 4) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_kill killed %d keys and %d values, expected 4 and 4.\n",
+                key_kills, value_kills);
+        exit(EXIT_FAILURE);
+    }
+    key_kills = 0;
+    value_kills = 0;
+
+    fprintf(stderr, "Test succeeded: table_update counted the keys.\n");
+}
+
+/**
+ * replace_test() - Test replacing a value with table_update.
+ *
+ * The old value must be killed exactly once and the table must keep
+ * its own key.
+ */
+void replace_test(void)
+{
+    fprintf(stderr, "Starting replace_test()...");
+
+    table *t = table_empty(count_compares, kill_key, kill_value);
+    int k = 7;
+    table_insert(t, new_int(7), new_int(70));
+
+    int *v = table_update(t, &k, replace, new_int(700));
+    if (*v != 700 || *(int *)table_lookup(t, &k) != 700) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_update did not replace the value.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (value_kills != 1 || key_kills != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: replacing killed %d values and %d keys, expected 1 and 0.\n",
+                value_kills, key_kills);
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    key_kills = 0;
+    value_kills = 0;
+
+    fprintf(stderr, "Test succeeded: table_update replaced the value.\n");
+}
+
+/**
+ * absent_test() - Test table_update on an absent key without insert.
+ *
+ * only_present() returns NULL for an absent key, which must leave the
+ * table unchanged.
+ */
+void absent_test(void)
+{
+    fprintf(stderr, "Starting absent_test()...");
+
+    table *t = table_empty(count_compares, NULL, NULL);
+    int k = 4;
+
+    if (table_update(t, &k, only_present, NULL) != NULL || !table_is_empty(t)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_update inserted a key for a NULL value.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int v = 1;
+    table_insert(t, &k, &v);
+    if (table_update(t, &k, only_present, NULL) != &v || v != 11) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_update did not update a present key.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    fprintf(stderr, "Test succeeded: table_update left the table unchanged.\n");
+}
+
+/**
+ * single_search_test() - Test that table_update searches once.
+ *
+ * Inserting an absent key into a table of n keys with table_update
+ * must compare keys at most n times, while table_lookup followed by
+ * table_insert may compare up to 2n times. Hashed tables compare
+ * fewer keys.
+ */
+void single_search_test(void)
+{
+    fprintf(stderr, "Starting single_search_test()...");
+
+    int n = 100;
+    int keys[101];
+    table *t = table_empty(count_compares, NULL, kill_value);
+
+    for (int i = 0; i <= n; i++) {
+        keys[i] = i;
+    }
+    for (int i = 0; i < n; i++) {
+        table_insert(t, &keys[i], new_int(1));
+    }
+
+    compares = 0;
+    table_update(t, &keys[n], increment, NULL);
+    int update_compares = compares;
+    if (update_compares > n) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_update compared %d keys in a table of %d keys.\n",
+                update_compares, n);
+        exit(EXIT_FAILURE);
+    }
+    if (table_lookup(t, &keys[n]) == NULL) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_update did not insert the absent key.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    value_kills = 0;
+    fprintf(stderr, "Test succeeded: table_update compared %d keys.\n", update_compares);
+}
+
+/**
+ * lookup_or_insert_test() - Test deduplication with table_lookup_or_insert.
+ *
+ * Each distinct key must get exactly one value, made on its first
+ * occurrence, and later occurrences must return the same value.
+ */
+void lookup_or_insert_test(void)
+{
+    fprintf(stderr, "Starting lookup_or_insert_test()...");
+
+    table *t = table_empty(count_compares, kill_key, kill_value);
+    int input[8] = { 3, 1, 3, 2, 3, 1, 3, 5 };
+    int *first[6] = { NULL };
+
+    for (int i = 0; i < 8; i++) {
+        int *k = new_int(input[i]);
+        int made = makes;
+        int *v = table_lookup_or_insert(t, k, make_zero);
+        (*v)++;
+        if (first[input[i]] == NULL) {
+            first[input[i]] = v;
+        }
+        if (v != first[input[i]] || (makes > made) != (*v == 1)) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: key %d got a new value on a later occurrence.\n", input[i]);
+            exit(EXIT_FAILURE);
+        }
+        if (makes == made) {
+            // Present key: the caller still owns k.
+            free(k);
+        }
+    }
+    if (makes != 4 || *first[3] != 4 || *first[1] != 2) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: %d values were made for 4 distinct keys.\n", makes);
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    if (key_kills != 4 || value_kills != 4) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_kill killed %d keys and %d values, expected 4 and 4.\n",
+                key_kills, value_kills);
+        exit(EXIT_FAILURE);
+    }
+    key_kills = 0;
+    value_kills = 0;
+    makes = 0;
+
+    fprintf(stderr, "Test succeeded: each key got one value.\n");
+}
+
+/**
+ * lookup_or_insert_search_test() - Test that table_lookup_or_insert searches once.
+ *
+ * As single_search_test(), for a present and an absent key.
+ */
+void lookup_or_insert_search_test(void)
+{
+    fprintf(stderr, "Starting lookup_or_insert_search_test()...");
+
+    int n = 100;
+    int keys[101];
+    table *t = table_empty(count_compares, NULL, kill_value);
+
+    for (int i = 0; i <= n; i++) {
+        keys[i] = i;
+    }
+    for (int i = 0; i < n; i++) {
+        table_insert(t, &keys[i], new_int(1));
+    }
+
+    compares = 0;
+    int *v = table_lookup_or_insert(t, &keys[n], make_zero);
+    int absent_compares = compares;
+    compares = 0;
+    int *w = table_lookup_or_insert(t, &keys[0], make_zero);
+    int present_compares = compares;
+    if (absent_compares > n || present_compares > n + 1) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_lookup_or_insert compared %d and %d keys in a table "
+                "of %d keys.\n", absent_compares, present_compares, n);
+        exit(EXIT_FAILURE);
+    }
+    if (*v != 0 || *w != 1 || makes != 1) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_lookup_or_insert returned the wrong values.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    value_kills = 0;
+    makes = 0;
+    fprintf(stderr, "Test succeeded: table_lookup_or_insert compared %d keys.\n",
+            absent_compares);
+}
+
+/**
+ * null_value_test() - Test a present key whose value is NULL.
+ *
+ * The key is present, so table_lookup_or_insert must not call
+ * make_value, must return NULL and must leave the caller as the owner
+ * of its key. table_update must report the key as present.
+ */
+void null_value_test(void)
+{
+    fprintf(stderr, "Starting null_value_test()...");
+
+    table *t = table_empty(count_compares, kill_key, NULL);
+    table_insert(t, new_int(4), NULL);
+
+    int *k = new_int(4);
+    void *v = table_lookup_or_insert(t, k, make_zero);
+    if (v != NULL || makes != 0 || key_kills != 0) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: a present key with a NULL value got a new value.\n");
+        exit(EXIT_FAILURE);
+    }
+    // The caller still owns k.
+    free(k);
+
+    int four = 4;
+    int ten = 10;
+    if (table_update(t, &four, replace_if_present, &ten) != &ten ||
+        table_lookup(t, &four) != &ten) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_update did not see the key with a NULL value.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    table_kill(t);
+    if (key_kills != 1) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: table_kill killed %d keys, expected 1.\n", key_kills);
+        exit(EXIT_FAILURE);
+    }
+    key_kills = 0;
+
+    fprintf(stderr, "Test succeeded: the key with a NULL value was kept.\n");
+}
+
+int main(void)
+{
+    count_test();                   // Test counting in place
+    replace_test();                 // Test replacing a value
+    absent_test();                  // Test an absent key without insert
+    single_search_test();           // Test that one search is done
+    lookup_or_insert_test();        // Test deduplication
+    lookup_or_insert_search_test(); // Test that one search is done
+    null_value_test();              // Test a present key with a NULL value
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}
@@ -0,0 +1,257 @@
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "wsdeque.h"
+
+// Initial number of slots in the circular array. Must be a power of 2.
+#define INITIAL_SIZE 64
+
+/*
+ * Implementation of a work-stealing deque of integers (Chase-Lev
+ * deque) for the "Datastructures and algorithms" courses at the
+ * Department of Computing Science, Umea University.
+ *
+ * The elements live in a circular array indexed by two ever-growing
+ * counters: top, where thieves steal, and bottom, where the owner
+ * pushes and pops. Only the owner writes bottom, and top is only
+ * advanced by compare-and-swap, so the only contended case is a pop
+ * and a steal racing for the last element, which the swap on top
+ * resolves. The memory orderings follow Le, Pop, Cohen and Zappa
+ * Nardelli, "Correct and efficient work-stealing for weak memory
+ * models" (PPoPP 2013).
+ *
+ * Note that top and bottom have the opposite meaning of the stack
+ * ends: the owner's stack top is at the deque's bottom index.
+ *
+ * When the array is full, the owner copies the elements to an array
+ * of twice the size. A thief may still read the old array, so old
+ * arrays are kept until wsdeque_kill().
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ===========INTERNAL DATA TYPES ============
+
+typedef struct array {
+    struct array *prev; // The array this one replaced, or NULL
+    long size; // Number of slots, a power of 2
+    _Atomic int slots[];
+} array;
+
+struct wsdeque {
+    _Atomic long top; // Index of the oldest element
+    _Atomic long bottom; // Index after the newest element
+    _Atomic(array *) elements;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS ============
+
+/**
+ * array_new() - Allocate a circular array.
+ * @size: Number of slots.
+ * @prev: The array it replaces, or NULL.
+ *
+ * Returns: A pointer to the new array.
+ */
+static array *array_new(long size, array *prev)
+{
+    array *a = malloc(sizeof(*a) + size * sizeof(a->slots[0]));
+    a->prev = prev;
+    a->size = size;
+
+    return a;
+}
+
+// Internal functions to access a slot of a circular array.
+static int array_get(array *a, long i)
+{
+    return atomic_load_explicit(&a->slots[i & (a->size - 1)], memory_order_relaxed);
+}
+
+static void array_put(array *a, long i, int v)
+{
+    atomic_store_explicit(&a->slots[i & (a->size - 1)], v, memory_order_relaxed);
+}
+
+/**
+ * grow() - Replace the array of a deque by one of twice the size.
+ * @d: Deque to manipulate.
+ * @a: Current array.
+ * @t: Current top index.
+ * @b: Current bottom index.
+ *
+ * Owner only.
+ *
+ * Returns: The new array.
+ */
+static array *grow(wsdeque *d, array *a, long t, long b)
+{
+    array *bigger = array_new(2 * a->size, a);
+
+    for (long i = t; i < b; i++) {
+        array_put(bigger, i, array_get(a, i));
+    }
+    atomic_store_explicit(&d->elements, bigger, memory_order_release);
+
+    return bigger;
+}
+
+/**
+ * wsdeque_empty() - Create an empty deque.
+ *
+ * Returns: A pointer to the new deque.
+ */
+wsdeque *wsdeque_empty(void)
+{
+    wsdeque *d = malloc(sizeof(*d));
+
+    atomic_init(&d->top, 0);
+    atomic_init(&d->bottom, 0);
+    atomic_init(&d->elements, array_new(INITIAL_SIZE, NULL));
+
+    return d;
+}
+
+/**
+ * wsdeque_is_empty() - Check if a deque is empty.
+ * @d: Deque to check.
+ *
+ * Returns: True if deque is empty, otherwise false.
+ */
+bool wsdeque_is_empty(const wsdeque *d)
+{
+    wsdeque *m = (wsdeque *)d;
+    long t = atomic_load_explicit(&m->top, memory_order_acquire);
+    long b = atomic_load_explicit(&m->bottom, memory_order_acquire);
+
+    return b <= t;
+}
+
+/**
+ * wsdeque_push() - Push a value on top of a deque.
+ * @d: Deque to manipulate.
+ * @v: Value to be put on the deque.
+ *
+ * Returns: Nothing.
+ */
+void wsdeque_push(wsdeque *d, int v)
+{
+    long b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&d->top, memory_order_acquire);
+    array *a = atomic_load_explicit(&d->elements, memory_order_relaxed);
+
+    if (b - t > a->size - 1) {
+        a = grow(d, a, t, b);
+    }
+    array_put(a, b, v);
+    // The element must be visible before a thief can see the new bottom.
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+}
+
+/**
+ * wsdeque_pop() - Remove the element at the top of a deque.
+ * @d: Deque to manipulate.
+ * @v: Set to the removed element, if any.
+ *
+ * Returns: True if an element was removed, otherwise false.
+ */
+bool wsdeque_pop(wsdeque *d, int *v)
+{
+    long b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+    array *a = atomic_load_explicit(&d->elements, memory_order_relaxed);
+
+    // Reserve the element before looking at top, so that a thief
+    // either sees the reservation or is seen by the owner.
+    atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long t = atomic_load_explicit(&d->top, memory_order_relaxed);
+
+    bool found = false;
+    if (t <= b) {
+        *v = array_get(a, b);
+        found = true;
+        if (t == b) {
+            // The last element. Race any thieves for it.
+            found = atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+                                                            memory_order_seq_cst,
+                                                            memory_order_relaxed);
+            atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        // Empty. Restore bottom.
+        atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+    }
+
+    return found;
+}
+
+/**
+ * wsdeque_top() - Inspect the element at the top of a deque.
+ * @d: Deque to inspect.
+ * @v: Set to the top element, if any.
+ *
+ * Returns: True if the deque was non-empty, otherwise false.
+ */
+bool wsdeque_top(const wsdeque *d, int *v)
+{
+    wsdeque *m = (wsdeque *)d;
+    long b = atomic_load_explicit(&m->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&m->top, memory_order_acquire);
+
+    if (b <= t) {
+        return false;
+    }
+    // The slot is only overwritten by the owner, so the value is
+    // valid even if a thief takes the element meanwhile.
+    *v = array_get(atomic_load_explicit(&m->elements, memory_order_relaxed), b - 1);
+
+    return true;
+}
+
+/**
+ * wsdeque_steal() - Remove the element at the bottom of a deque.
+ * @d: Deque to steal from.
+ * @v: Set to the removed element, if any.
+ *
+ * Returns: True if an element was removed, otherwise false.
+ */
+bool wsdeque_steal(wsdeque *d, int *v)
+{
+    long t = atomic_load_explicit(&d->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+
+    if (t >= b) {
+        return false;
+    }
+    array *a = atomic_load_explicit(&d->elements, memory_order_acquire);
+    int x = array_get(a, t);
+    if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1, memory_order_seq_cst,
+                                                 memory_order_relaxed)) {
+        // Lost the race to the owner or another thief.
+        return false;
+    }
+    *v = x;
+
+    return true;
+}
+
+/**
+ * wsdeque_kill() - Destroy a given deque.
+ * @d: Deque to destroy.
+ *
+ * Returns: Nothing.
+ */
+void wsdeque_kill(wsdeque *d)
+{
+    array *a = atomic_load(&d->elements);
+
+    while (a != NULL) {
+        array *prev = a->prev;
+        free(a);
+        a = prev;
+    }
+    free(d);
+}
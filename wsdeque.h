@@ -0,0 +1,112 @@
+#ifndef __WSDEQUE_H
+#define __WSDEQUE_H
+
+#include <stdbool.h>
+
+/*
+ * Declaration of a work-stealing deque of integers for the
+ * "Datastructures and algorithms" courses at the Department of
+ * Computing Science, Umea University.
+ *
+ * The deque is owned by one thread, which uses it as a stack:
+ * wsdeque_push(), wsdeque_pop() and wsdeque_top() work on the top end
+ * like the corresponding int_stack.h functions. Any number of other
+ * threads may concurrently take elements from the bottom end with
+ * wsdeque_steal(), so the oldest elements are stolen first. A typical
+ * use is a per-worker queue of task ids in a thread pool, where idle
+ * workers steal from busy ones.
+ *
+ * Since the elements may be stolen at any time, the owner functions
+ * return the element through a pointer and report whether there was
+ * one, instead of having a separate top and pop.
+ *
+ * The implementation uses C11 atomics and must be compiled with
+ * -std=c11 or later.
+ *
+ * Version information:
+ *   v1.0  2026-10-18: First version.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+typedef struct wsdeque wsdeque;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * wsdeque_empty() - Create an empty deque.
+ *
+ * Returns: A pointer to the new deque.
+ */
+wsdeque *wsdeque_empty(void);
+
+/**
+ * wsdeque_is_empty() - Check if a deque is empty.
+ * @d: Deque to check.
+ *
+ * May be called by any thread. With concurrent operations, the answer
+ * may be out of date as soon as it is returned.
+ *
+ * Returns: True if deque is empty, otherwise false.
+ */
+bool wsdeque_is_empty(const wsdeque *d);
+
+/**
+ * wsdeque_push() - Push a value on top of a deque.
+ * @d: Deque to manipulate.
+ * @v: Value to be put on the deque.
+ *
+ * Owner only. The storage grows as needed.
+ *
+ * Returns: Nothing.
+ */
+void wsdeque_push(wsdeque *d, int v);
+
+/**
+ * wsdeque_pop() - Remove the element at the top of a deque.
+ * @d: Deque to manipulate.
+ * @v: Set to the removed element, if any.
+ *
+ * Owner only.
+ *
+ * Returns: True if an element was removed, false if the deque was
+ *          empty or its last element was stolen.
+ */
+bool wsdeque_pop(wsdeque *d, int *v);
+
+/**
+ * wsdeque_top() - Inspect the element at the top of a deque.
+ * @d: Deque to inspect.
+ * @v: Set to the top element, if any.
+ *
+ * Owner only. If the deque holds a single element, a thief may steal
+ * it right after it has been inspected.
+ *
+ * Returns: True if the deque was non-empty, otherwise false.
+ */
+bool wsdeque_top(const wsdeque *d, int *v);
+
+/**
+ * wsdeque_steal() - Remove the element at the bottom of a deque.
+ * @d: Deque to steal from.
+ * @v: Set to the removed element, if any.
+ *
+ * May be called by any thread except the owner.
+ *
+ * Returns: True if an element was removed. False if the deque was
+ *          empty or another thread took the element first; in the
+ *          latter case the caller may retry.
+ */
+bool wsdeque_steal(wsdeque *d, int *v);
+
+/**
+ * wsdeque_kill() - Destroy a given deque.
+ * @d: Deque to destroy.
+ *
+ * Must not run concurrently with other operations on the deque.
+ *
+ * Returns: Nothing.
+ */
+void wsdeque_kill(wsdeque *d);
+
+#endif
@@ -0,0 +1,198 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "bench_clock.h"
+#include "wsdeque.h"
+
+/**
+ * wsdeque_bench.c - Thread pool benchmark for the work-stealing deque.
+ *
+ *   gcc -std=c11 -O2 -pthread wsdeque_bench.c wsdeque.c bench_clock.c
+ *
+ * Usage: wsdeque_bench [height] [work] [workers]
+ *
+ * Runs an unbalanced task tree on a pool of workers (default: the
+ * number of online cores), each with its own wsdeque of task ids. A
+ * task id is the height h of its subtree; the task spins for work
+ * iterations (default 1000) and, if h >= 2, spawns tasks h - 1 and
+ * h - 2. The root (default height 24) is pushed on worker 0 only, so
+ * all work starts in one place. The tree is run twice:
+ *  - own:   each worker only pops from its own deque, as with one
+ *           int_stack per worker,
+ *  - steal: idle workers steal from the bottom of random victims.
+ * For each run the elapsed time and the number of tasks run by each
+ * worker are printed.
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ * 2026-10-18 v1.1: Clock helpers moved to bench_clock.c.
+ */
+
+#define DEFAULT_HEIGHT 24
+#define DEFAULT_WORK 1000
+
+// Shared state of the pool.
+typedef struct pool {
+    wsdeque **deques; // One deque per worker
+    int workers;
+    bool steal; // Whether idle workers steal
+    int work; // Spin iterations per task
+    _Atomic long pending; // Tasks pushed but not yet finished
+} pool;
+
+// State of one worker.
+typedef struct worker {
+    pool *p;
+    int id;
+    long tasks; // Number of tasks run by this worker
+    unsigned seed; // Random state for picking victims
+} worker;
+
+/**
+ * run_task() - Run one task and spawn its children.
+ * @w: Worker running the task.
+ * @h: Task id, the height of its subtree.
+ *
+ * Returns: Nothing.
+ */
+static void run_task(worker *w, int h)
+{
+    pool *p = w->p;
+    volatile int sink = 0;
+
+    for (int i = 0; i < p->work; i++) {
+        sink += i;
+    }
+    if (h >= 2) {
+        // Count the children before they become visible to thieves.
+        atomic_fetch_add(&p->pending, 2);
+        wsdeque_push(p->deques[w->id], h - 1);
+        wsdeque_push(p->deques[w->id], h - 2);
+    }
+    w->tasks++;
+    atomic_fetch_sub(&p->pending, 1);
+}
+
+/**
+ * find_task() - Find a task for a worker.
+ * @w: Worker looking for a task.
+ * @h: Set to the task id.
+ *
+ * Pops from the own deque first, then tries to steal from one random
+ * victim if stealing is enabled.
+ *
+ * Returns: True if a task was found, otherwise false.
+ */
+static bool find_task(worker *w, int *h)
+{
+    pool *p = w->p;
+
+    if (wsdeque_pop(p->deques[w->id], h)) {
+        return true;
+    }
+    if (p->steal && p->workers > 1) {
+        int victim = rand_r(&w->seed) % (p->workers - 1);
+        // Skip the own deque.
+        if (victim >= w->id) {
+            victim++;
+        }
+        return wsdeque_steal(p->deques[victim], h);
+    }
+    return false;
+}
+
+// Thread function for a worker. Runs tasks until no tasks remain.
+static void *worker_thread(void *arg)
+{
+    worker *w = arg;
+    int h;
+
+    while (atomic_load(&w->p->pending) > 0) {
+        if (find_task(w, &h)) {
+            run_task(w, h);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/**
+ * run_pool() - Run the task tree on a pool and print the result.
+ * @name: Name of the run.
+ * @height: Height of the root task.
+ * @work: Spin iterations per task.
+ * @workers: Number of workers.
+ * @steal: Whether idle workers steal.
+ *
+ * Returns: Nothing.
+ */
+static void run_pool(const char *name, int height, int work, int workers, bool steal)
+{
+    pool p = { malloc(workers * sizeof(wsdeque *)), workers, steal, work, 1 };
+    worker *w = malloc(workers * sizeof(*w));
+    pthread_t *tid = malloc(workers * sizeof(*tid));
+
+    for (int i = 0; i < workers; i++) {
+        p.deques[i] = wsdeque_empty();
+        w[i] = (worker) { &p, i, 0, i + 1 };
+    }
+    wsdeque_push(p.deques[0], height);
+
+    long long start = now_ns();
+    for (int i = 0; i < workers; i++) {
+        pthread_create(&tid[i], NULL, worker_thread, &w[i]);
+    }
+    for (int i = 0; i < workers; i++) {
+        pthread_join(tid[i], NULL);
+    }
+    long long ns = now_ns() - start;
+
+    long total = 0;
+    long max = 0;
+    printf("%-5s workers=%d %.2f ms, tasks per worker:", name, workers, ns / 1e6);
+    for (int i = 0; i < workers; i++) {
+        printf(" %ld", w[i].tasks);
+        total += w[i].tasks;
+        max = w[i].tasks > max ? w[i].tasks : max;
+        wsdeque_kill(p.deques[i]);
+    }
+    printf(" (total %ld, max/mean %.2f)\n", total, (double)max * workers / total);
+
+    free(p.deques);
+    free(w);
+    free(tid);
+}
+
+int main(int argc, char *argv[])
+{
+    int height = DEFAULT_HEIGHT;
+    int work = DEFAULT_WORK;
+    int workers = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (argc > 1) {
+        height = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        work = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        workers = atoi(argv[3]);
+    }
+    if (height < 0 || work < 0 || workers <= 0) {
+        fprintf(stderr, "Usage: %s [height] [work] [workers]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    run_pool("own", height, work, workers, false);
+    run_pool("steal", height, work, workers, true);
+
+    return 0;
+}
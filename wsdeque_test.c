@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "wsdeque.h"
+
+/**
+ * wsdeque_test.c - Unit and stress tests for the work-stealing deque.
+ *
+ * This file contains tests for the deque declared in wsdeque.h. The
+ * single-threaded tests check that the owner sees a stack and that
+ * thieves take the oldest elements. The stress test runs one owner
+ * and several thieves concurrently and checks that every element is
+ * taken exactly once. Each test terminates the program with an error
+ * message if it fails.
+ *
+ * Compile with: gcc -std=c11 -pthread wsdeque_test.c wsdeque.c
+ *
+ * Version information:
+ * 2026-10-18 v1.0: Initial version.
+ */
+
+// Number of thieves and elements in the stress test.
+#define THIEVES 4
+#define ELEMENTS 500000
+
+/**
+ * owner_test() - Test push, top and pop from the owner side.
+ *
+ * Pushes enough elements to grow the array and checks that top and
+ * pop see them in LIFO order, and that pop fails on an empty deque.
+ */
+void owner_test(void)
+{
+    fprintf(stderr, "Starting owner_test()...");
+
+    int n = 1000;
+    wsdeque *d = wsdeque_empty();
+    int v;
+
+    if (!wsdeque_is_empty(d) || wsdeque_top(d, &v) || wsdeque_pop(d, &v)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: wsdeque_empty() did not create an empty deque.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < n; i++) {
+        wsdeque_push(d, i);
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        int top;
+        if (!wsdeque_top(d, &top) || !wsdeque_pop(d, &v) || top != i || v != i) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: expected %d at the top.\n", i);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (!wsdeque_is_empty(d) || wsdeque_pop(d, &v)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: deque not empty after popping all elements.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: the owner saw %d elements in LIFO order.\n", n);
+    wsdeque_kill(d);
+}
+
+/**
+ * steal_test() - Test that steal takes the oldest element.
+ *
+ * Pushes 1, 2, 3 and checks that a steal returns 1 while the owner
+ * still sees 3 at the top.
+ */
+void steal_test(void)
+{
+    fprintf(stderr, "Starting steal_test()...");
+
+    wsdeque *d = wsdeque_empty();
+    int v;
+
+    for (int i = 1; i <= 3; i++) {
+        wsdeque_push(d, i);
+    }
+    if (!wsdeque_steal(d, &v) || v != 1) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: expected to steal 1.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (!wsdeque_pop(d, &v) || v != 3 || !wsdeque_steal(d, &v) || v != 2) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: expected to pop 3 and steal 2.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (wsdeque_steal(d, &v)) {
+        // Fail with error message
+        fprintf(stderr, "FAIL: stole from an empty deque.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(stderr, "Test succeeded: steal took the oldest elements.\n");
+    wsdeque_kill(d);
+}
+
+// Shared state for the stress test.
+typedef struct stress_arg {
+    wsdeque *d;
+    _Atomic int *seen; // seen[v] counts how many times v was taken
+    atomic_bool *done; // Set by the owner when it has finished
+} stress_arg;
+
+// Internal function to record that an element was taken.
+static void take(stress_arg *a, int v)
+{
+    atomic_fetch_add_explicit(&a->seen[v], 1, memory_order_relaxed);
+}
+
+// Thief thread for the stress test. Steals until the owner is done
+// and the deque is empty.
+static void *thief_thread(void *p)
+{
+    stress_arg *a = p;
+    int v;
+
+    while (!atomic_load(a->done) || !wsdeque_is_empty(a->d)) {
+        if (wsdeque_steal(a->d, &v)) {
+            take(a, v);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * stress_test() - Test concurrent pops and steals.
+ *
+ * The owner pushes ELEMENTS unique elements and pops one after every
+ * third push, while THIEVES threads steal. The owner drains the deque
+ * at the end. Every element must be taken exactly once.
+ */
+void stress_test(void)
+{
+    fprintf(stderr, "Starting stress_test()...");
+
+    wsdeque *d = wsdeque_empty();
+    _Atomic int *seen = calloc(ELEMENTS, sizeof(*seen));
+    atomic_bool done = false;
+    stress_arg arg = { d, seen, &done };
+    pthread_t thieves[THIEVES];
+    int v;
+
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_create(&thieves[t], NULL, thief_thread, &arg);
+    }
+    for (int i = 0; i < ELEMENTS; i++) {
+        wsdeque_push(d, i);
+        if (i % 3 == 2 && wsdeque_pop(d, &v)) {
+            take(&arg, v);
+        }
+    }
+    while (wsdeque_pop(d, &v)) {
+        take(&arg, v);
+    }
+    atomic_store(&done, true);
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_join(thieves[t], NULL);
+    }
+
+    for (int i = 0; i < ELEMENTS; i++) {
+        if (seen[i] != 1) {
+            // Fail with error message
+            fprintf(stderr, "FAIL: element %d was taken %d times.\n", i, (int)seen[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    fprintf(stderr, "Test succeeded: %d elements were taken exactly once.\n", ELEMENTS);
+    wsdeque_kill(d);
+    free(seen);
+}
+
+int main(void)
+{
+    owner_test();       // Test the owner side
+    steal_test();       // Test wsdeque_steal
+    stress_test();      // Test concurrent use
+
+    fprintf(stderr, "SUCCESS: Implementation passed all tests. Normal exit.\n");
+    return 0;
+}